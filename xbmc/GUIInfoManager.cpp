@@ -11058,6 +11058,28 @@ INFO::InfoPtr CGUIInfoManager::Register(const std::string &expression, int conte
   return *(res.first);
 }
 
+INFO::InfoBool::Dependencies CGUIInfoManager::GetDependencies(
+    int condition, const INFO::InfoBool::Dependencies& volatileDeps) const
+{
+  condition = std::abs(condition);
+  if (condition == SYSTEM_ALWAYS_TRUE || condition == SYSTEM_ALWAYS_FALSE)
+    return {};
+
+  if (condition >= LISTITEM_START && condition <= LISTITEM_END)
+    return volatileDeps;
+
+  CGUIInfo info(condition);
+  if (condition >= MULTI_INFO_START && condition <= MULTI_INFO_END)
+    info = m_multiInfo[condition - MULTI_INFO_START];
+
+  // only conditions whose provider tells us about changes may skip the per frame update
+  const INFO::InfoBool::RefreshCounter* changeCounter = m_infoProviders.GetBoolChangeCounter(info);
+  if (!changeCounter)
+    return volatileDeps;
+
+  return {&m_resetCounter, changeCounter};
+}
+
 void CGUIInfoManager::UnRegister(const INFO::InfoPtr& expression)
 {
   std::unique_lock<CCriticalSection> lock(m_critInfo);
@@ -11647,7 +11669,15 @@ bool CGUIInfoManager::GetItemBool(const CGUIListItem *item, int contextWindow, i
 
 void CGUIInfoManager::ResetCache()
 {
-  // mark our infobools as dirty
+  // mark all our infobools as dirty
+  std::unique_lock<CCriticalSection> lock(m_critInfo);
+  ++m_resetCounter;
+  ++m_refreshCounter;
+}
+
+void CGUIInfoManager::ResetFrameCache()
+{
+  // mark the infobools without change notification as dirty
   std::unique_lock<CCriticalSection> lock(m_critInfo);
   ++m_refreshCounter;
 }
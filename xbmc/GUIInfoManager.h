@@ -62,8 +62,13 @@ public:
   void Initialize();
 
   void Clear();
+
+  /*! \brief Invalidate all cached info bools, e.g. when the active window changes */
   void ResetCache();
 
+  /*! \brief Invalidate the info bools that have to be evaluated once per frame */
+  void ResetFrameCache();
+
   // KODI::MESSAGING::IMessageTarget implementation
   int GetMessageMask() override;
   void OnApplicationMessage(KODI::MESSAGING::ThreadMessage* pMsg) override;
@@ -87,6 +92,14 @@ public:
    */
   void UnRegister(const INFO::InfoPtr& expression);
 
+  /*! \brief Get the refresh counters a cached value of a single condition depends on
+   \param condition the condition as returned by TranslateSingleString
+   \param volatileDeps the dependencies of conditions that have to be evaluated every frame
+   \return the refresh counters, empty if the condition is constant
+   */
+  INFO::InfoBool::Dependencies GetDependencies(
+      int condition, const INFO::InfoBool::Dependencies& volatileDeps) const;
+
   /// \brief iterates through boolean conditions and compares their stored values to current values. Returns true if any condition changed value.
   bool ConditionsChangedValues(const std::map<INFO::InfoPtr, bool>& map);
 
@@ -220,7 +233,8 @@ private:
 
   typedef std::set<INFO::InfoPtr, bool(*)(const INFO::InfoPtr&, const INFO::InfoPtr&)> INFOBOOLTYPE;
   INFOBOOLTYPE m_bools;
-  unsigned int m_refreshCounter = 0;
+  INFO::InfoBool::RefreshCounter m_refreshCounter{0}; //!< bumped every frame
+  INFO::InfoBool::RefreshCounter m_resetCounter{0}; //!< bumped on full cache resets
   std::vector<INFO::CSkinVariableString> m_skinVariableStrings;
 
   CCriticalSection m_critInfo;
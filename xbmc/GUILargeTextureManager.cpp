@@ -12,6 +12,7 @@
 #include "TextureCache.h"
 #include "commons/ilog.h"
 #include "guilib/GUIComponent.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/Texture.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
@@ -146,6 +147,20 @@ void CGUILargeTextureManager::CLargeTexture::SetTexture(std::unique_ptr<CTexture
   }
 }
 
+size_t CGUILargeTextureManager::CLargeTexture::GetUploadSize() const
+{
+  if (m_uploadScheduled)
+    return 0;
+
+  size_t size = 0;
+  for (const auto& texture : m_texture.m_textures)
+  {
+    if (!texture->IsLoadedToGPU())
+      size += static_cast<size_t>(texture->GetPitch()) * texture->GetRows();
+  }
+  return size;
+}
+
 CGUILargeTextureManager::CGUILargeTextureManager() = default;
 
 CGUILargeTextureManager::~CGUILargeTextureManager() = default;
@@ -177,6 +192,8 @@ bool CGUILargeTextureManager::GetImage(const std::string &path, CTextureArray &t
     {
       if (firstRequest)
         image->AddRef();
+      if (!CanUpload(*image))
+        return true; // not ready as yet
       texture = image->GetTexture();
       return texture.size() > 0;
     }
@@ -188,6 +205,37 @@ bool CGUILargeTextureManager::GetImage(const std::string &path, CTextureArray &t
   return true;
 }
 
+bool CGUILargeTextureManager::CanUpload(CLargeTexture& image)
+{
+  const size_t size = image.GetUploadSize();
+  if (size == 0)
+    return true;
+
+  const unsigned int frameTime = CTimeUtils::GetFrameTime();
+  if (frameTime != m_uploadFrameTime)
+  {
+    m_uploadFrameTime = frameTime;
+    m_uploadedBytes = 0;
+    m_uploadedInFrame = false;
+  }
+
+  const size_t budget = static_cast<size_t>(CServiceBroker::GetSettingsComponent()
+                                                ->GetAdvancedSettings()
+                                                ->m_guiTextureUploadBudget) *
+                        1024;
+  if (m_uploadedInFrame && budget > 0 && m_uploadedBytes + size > budget)
+  {
+    GUIFRAMEPROFILER_COUNT(TEXTURE_UPLOADS_DEFERRED);
+    return false;
+  }
+
+  // the texture is uploaded when it's rendered, other controls showing it don't add to the budget
+  image.SetUploadScheduled();
+  m_uploadedBytes += size;
+  m_uploadedInFrame = true;
+  return true;
+}
+
 void CGUILargeTextureManager::ReleaseImage(const std::string &path, bool immediately)
 {
   std::unique_lock<CCriticalSection> lock(m_listSection);
@@ -74,6 +74,10 @@ public:
    object filled if the texture has been previously loaded, else will return with an empty texture
    object if it is being loaded.
 
+   Textures which still have to be uploaded to the GPU are handed out within the upload budget of
+   the frame (advanced setting textureuploadbudget), the others are handed out in the next frames.
+   The first one of a frame is always handed out, so large images are never held back.
+
    \param path path of the image to load.
    \param texture texture object to hold the resulting texture
    \param orientation orientation of resulting texture
@@ -122,6 +126,10 @@ private:
     const std::string& GetPath() const { return m_path; }
     const CTextureArray& GetTexture() const { return m_texture; }
 
+    /*! \brief number of bytes the first render of the texture uploads to the GPU */
+    size_t GetUploadSize() const;
+    void SetUploadScheduled() { m_uploadScheduled = true; }
+
   private:
     static const unsigned int TIME_TO_DELETE = 2000;
 
@@ -129,9 +137,11 @@ private:
     std::string m_path;
     CTextureArray m_texture;
     unsigned int m_timeToDelete;
+    bool m_uploadScheduled{false};
   };
 
   void QueueImage(const std::string &path, bool useCache = true);
+  bool CanUpload(CLargeTexture& image);
 
   std::vector< std::pair<unsigned int, CLargeTexture *> > m_queued;
   std::vector<CLargeTexture *> m_allocated;
@@ -139,5 +149,9 @@ private:
   typedef std::vector< std::pair<unsigned int, CLargeTexture *> >::iterator queueIterator;
 
   CCriticalSection m_listSection;
+
+  unsigned int m_uploadFrameTime{0};
+  size_t m_uploadedBytes{0}; //!< bytes handed out for upload in the frame m_uploadFrameTime
+  bool m_uploadedInFrame{false};
 };
 
@@ -29,6 +29,7 @@
 #include "utils/URIUtils.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <mutex>
@@ -36,6 +37,17 @@
 #include <string.h>
 
 using namespace XFILE;
+
+namespace
+{
+// number of textures and time after which the use counts are written to the database
+constexpr size_t USE_COUNT_TEXTURES = 100;
+constexpr auto USE_COUNT_INTERVAL = std::chrono::seconds(30);
+
+// the hash check of an image is due a day after the last one, the lookups may be a bit older
+constexpr size_t LOOKUP_CACHE_SIZE = 2000;
+constexpr auto LOOKUP_CACHE_TIMEOUT = std::chrono::minutes(10);
+} // namespace
 using namespace std::chrono_literals;
 
 CTextureCache::CTextureCache()
@@ -56,8 +68,10 @@ void CTextureCache::Initialize()
 void CTextureCache::Deinitialize()
 {
   CancelJobs();
+  FlushUseCounts(true);
 
   std::unique_lock<CCriticalSection> lock(m_databaseSection);
+  m_lookups.clear();
   m_database.Close();
 }
 
@@ -240,44 +254,110 @@ bool CTextureCache::ClearCachedImage(int id)
 
 bool CTextureCache::GetCachedTexture(const std::string &url, CTextureDetails &details)
 {
+  const auto now = std::chrono::steady_clock::now();
   std::unique_lock<CCriticalSection> lock(m_databaseSection);
-  return m_database.GetCachedTexture(url, details);
+  const auto it = m_lookups.find(url);
+  if (it != m_lookups.end())
+  {
+    if (now - it->second.time < LOOKUP_CACHE_TIMEOUT)
+    {
+      details = it->second.details;
+      return true;
+    }
+    m_lookups.erase(it);
+  }
+
+  if (!m_database.GetCachedTexture(url, details))
+    return false;
+
+  // images needing a hash check are about to be recached, don't keep them
+  if (details.hash.empty())
+  {
+    if (m_lookups.size() >= LOOKUP_CACHE_SIZE)
+      m_lookups.clear();
+    m_lookups.emplace(url, CLookup{details, now});
+  }
+  return true;
 }
 
 bool CTextureCache::AddCachedTexture(const std::string &url, const CTextureDetails &details)
 {
   std::unique_lock<CCriticalSection> lock(m_databaseSection);
+  m_lookups.erase(url);
   return m_database.AddCachedTexture(url, details);
 }
 
+void CTextureCache::ClearLookupCache()
+{
+  std::unique_lock<CCriticalSection> lock(m_databaseSection);
+  m_lookups.clear();
+}
+
 void CTextureCache::IncrementUseCount(const CTextureDetails &details)
 {
-  static const size_t count_before_update = 100;
   std::unique_lock<CCriticalSection> lock(m_useCountSection);
-  m_useCounts.reserve(count_before_update);
-  m_useCounts.push_back(details);
-  if (m_useCounts.size() >= count_before_update)
+  auto& useCount = m_useCounts[{details.id, details.width, details.height}];
+  useCount.first = details;
+  useCount.second++;
+
+  if (m_useCounts.size() >= USE_COUNT_TEXTURES ||
+      std::chrono::steady_clock::now() - m_useCountsFlushed >= USE_COUNT_INTERVAL)
+    FlushUseCounts(false);
+}
+
+void CTextureCache::FlushUseCounts(bool immediately)
+{
+  CTextureUseCountJob::UseCounts useCounts;
   {
-    AddJob(new CTextureUseCountJob(m_useCounts));
+    std::unique_lock<CCriticalSection> lock(m_useCountSection);
+    m_useCountsFlushed = std::chrono::steady_clock::now();
+    if (m_useCounts.empty())
+      return;
+
+    useCounts.reserve(m_useCounts.size());
+    for (auto& useCount : m_useCounts)
+      useCounts.emplace_back(std::move(useCount.second));
     m_useCounts.clear();
   }
+
+  if (immediately)
+  {
+    std::unique_lock<CCriticalSection> lock(m_databaseSection);
+    if (m_database.IsOpen())
+      CTextureUseCountJob::Write(m_database, useCounts);
+  }
+  else
+    AddJob(new CTextureUseCountJob(std::move(useCounts)));
 }
 
 bool CTextureCache::SetCachedTextureValid(const std::string &url, bool updateable)
 {
   std::unique_lock<CCriticalSection> lock(m_databaseSection);
+  m_lookups.erase(url);
   return m_database.SetCachedTextureValid(url, updateable);
 }
 
+bool CTextureCache::InvalidateCachedTexture(const std::string& url)
+{
+  std::unique_lock<CCriticalSection> lock(m_databaseSection);
+  m_lookups.erase(url);
+  return m_database.InvalidateCachedTexture(url);
+}
+
 bool CTextureCache::ClearCachedTexture(const std::string &url, std::string &cachedURL)
 {
   std::unique_lock<CCriticalSection> lock(m_databaseSection);
+  m_lookups.erase(url);
   return m_database.ClearCachedTexture(url, cachedURL);
 }
 
 bool CTextureCache::ClearCachedTexture(int id, std::string &cachedURL)
 {
   std::unique_lock<CCriticalSection> lock(m_databaseSection);
+  const auto it = std::find_if(m_lookups.begin(), m_lookups.end(),
+                               [id](const auto& lookup) { return lookup.second.details.id == id; });
+  if (it != m_lookups.end())
+    m_lookups.erase(it);
   return m_database.ClearCachedTexture(id, cachedURL);
 }
 
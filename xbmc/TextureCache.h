@@ -18,8 +18,11 @@
 #include <atomic>
 #include <chrono>
 #include <memory>
+#include <map>
 #include <set>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
 class CGUIDialogProgress;
@@ -127,6 +130,13 @@ public:
    */
   bool ClearCachedImage(int textureID);
 
+  /*! \brief Have the given image checked for changes the next time it is used
+   Thread-safe wrapper of CTextureDatabase::InvalidateCachedTexture
+   \param image url of the original image
+   \return true if successful, false otherwise.
+   */
+  bool InvalidateCachedTexture(const std::string& image);
+
   /*! \brief retrieve a cache file (relative to the cache path) to associate with the given image, excluding extension
    Use GetCachedPath(GetCacheFile(url)+extension) for the full path to the file.
    \param url location of the image
@@ -159,6 +169,11 @@ public:
 
   bool CleanAllUnusedImages();
 
+  /*! \brief Forget the recently looked up textures
+   Needs to be called after changing textures through another CTextureDatabase instance.
+   */
+  void ClearLookupCache();
+
 private:
   // private construction, and no assignments; use the provided singleton methods
   CTextureCache(const CTextureCache&) = delete;
@@ -202,6 +217,11 @@ private:
    */
   void IncrementUseCount(const CTextureDetails &details);
 
+  /*! \brief Write the locally stored use counts to the database
+   \param immediately write them from this thread rather than via a CUseCountJob
+   */
+  void FlushUseCounts(bool immediately);
+
   /*! \brief Set a previously cached texture as valid in the database
    Thread-safe wrapper of CTextureDatabase::SetCachedTextureValid
    \param image url of the original image
@@ -231,7 +251,17 @@ private:
   std::set<std::string> m_processinglist; ///< currently processing list to avoid 2 jobs being processed at once
   CCriticalSection     m_processingSection;
   CEvent               m_completeEvent; ///< Set whenever a job has finished
-  std::vector<CTextureDetails> m_useCounts; ///< Use count tracking
+  std::map<std::tuple<int, unsigned int, unsigned int>, std::pair<CTextureDetails, unsigned int>>
+      m_useCounts; ///< Use counts by texture id, width and height, like the sizes table
+  std::chrono::steady_clock::time_point m_useCountsFlushed; ///< last write of the use counts
   CCriticalSection             m_useCountSection;
+
+  struct CLookup
+  {
+    CTextureDetails details;
+    std::chrono::steady_clock::time_point time;
+  };
+  std::unordered_map<std::string, CLookup>
+      m_lookups; ///< recent results of GetCachedTexture, protected by m_databaseSection
 };
 
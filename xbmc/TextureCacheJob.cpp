@@ -117,7 +117,12 @@ bool CTextureCacheJob::CacheTexture(std::unique_ptr<CTexture>* out_texture)
   std::unique_ptr<CTexture> texture = LoadImage(imageURL);
   if (texture)
   {
-    if (texture->HasAlpha())
+    if (StringUtils::EqualsNoCase(CServiceBroker::GetSettingsComponent()
+                                      ->GetAdvancedSettings()
+                                      ->m_imageCacheFormat,
+                                  "dds"))
+      m_details.file = m_cachePath + ".dds";
+    else if (texture->HasAlpha())
       m_details.file = m_cachePath + ".png";
     else
       m_details.file = m_cachePath + ".jpg";
@@ -225,7 +230,7 @@ std::string CTextureCacheJob::GetImageHash(const std::string &url)
   return "";
 }
 
-CTextureUseCountJob::CTextureUseCountJob(const std::vector<CTextureDetails> &textures) : m_textures(textures)
+CTextureUseCountJob::CTextureUseCountJob(UseCounts textures) : m_textures(std::move(textures))
 {
 }
 
@@ -244,11 +249,14 @@ bool CTextureUseCountJob::DoWork()
 {
   CTextureDatabase db;
   if (db.Open())
-  {
-    db.BeginTransaction();
-    for (std::vector<CTextureDetails>::const_iterator i = m_textures.begin(); i != m_textures.end(); ++i)
-      db.IncrementUseCount(*i);
-    db.CommitTransaction();
-  }
+    Write(db, m_textures);
   return true;
 }
+
+void CTextureUseCountJob::Write(CTextureDatabase& db, const UseCounts& textures)
+{
+  db.BeginTransaction();
+  for (const auto& [details, count] : textures)
+    db.IncrementUseCount(details, count);
+  db.CommitTransaction();
+}
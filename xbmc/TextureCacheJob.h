@@ -13,9 +13,11 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 class CTexture;
+class CTextureDatabase;
 namespace IMAGE_FILES
 {
 class CImageFileURL;
@@ -103,12 +105,17 @@ private:
 class CTextureUseCountJob : public CJob
 {
 public:
-  explicit CTextureUseCountJob(const std::vector<CTextureDetails> &textures);
+  using UseCounts = std::vector<std::pair<CTextureDetails, unsigned int>>;
+
+  explicit CTextureUseCountJob(UseCounts textures);
+
+  /*! \brief Add the use counts to the database in a single transaction */
+  static void Write(CTextureDatabase& db, const UseCounts& textures);
 
   const char* GetType() const override { return "usecount"; }
   bool operator==(const CJob *job) const override;
   bool DoWork() override;
 
 private:
-  std::vector<CTextureDetails> m_textures;
+  UseCounts m_textures;
 };
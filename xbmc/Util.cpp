@@ -74,6 +74,7 @@
 #include "utils/FileExtensionProvider.h"
 #include "utils/FontUtils.h"
 #include "utils/LangCodeExpander.h"
+#include "utils/RegExpSet.h"
 #include "utils/StringUtils.h"
 #include "utils/TimeUtils.h"
 #include "utils/URIUtils.h"
@@ -643,20 +644,14 @@ bool CUtil::ExcludeFileOrFolder(const std::string& strFileOrFolder, const std::v
   if (strFileOrFolder.empty())
     return false;
 
-  CRegExp regExExcludes(true, CRegExp::autoUtf8);  // case insensitive regex
-
-  for (const auto &regexp : regexps)
+  // case insensitive regex, compiled once per list
+  const auto regExExcludes = CRegExpSet::Get(regexps, true, CRegExp::autoUtf8);
+  const int match = regExExcludes->Find(strFileOrFolder);
+  if (match > -1)
   {
-    if (!regExExcludes.RegComp(regexp.c_str()))
-    { // invalid regexp - complain in logs
-      CLog::Log(LOGERROR, "{}: Invalid exclude RegExp:'{}'", __FUNCTION__, regexp);
-      continue;
-    }
-    if (regExExcludes.RegFind(strFileOrFolder) > -1)
-    {
-      CLog::LogF(LOGDEBUG, "File '{}' excluded. (Matches exclude rule RegExp: '{}')", CURL::GetRedacted(strFileOrFolder), regexp);
-      return true;
-    }
+    CLog::LogF(LOGDEBUG, "File '{}' excluded. (Matches exclude rule RegExp: '{}')",
+               CURL::GetRedacted(strFileOrFolder), regExExcludes->GetPattern(match));
+    return true;
   }
   return false;
 }
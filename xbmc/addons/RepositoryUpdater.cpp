@@ -9,6 +9,7 @@
 #include "RepositoryUpdater.h"
 
 #include "ServiceBroker.h"
+#include "TextureCache.h"
 #include "TextureDatabase.h"
 #include "addons/AddonDatabase.h"
 #include "addons/AddonEvents.h"
@@ -116,6 +117,7 @@ bool CRepositoryUpdateJob::DoWork()
       }
     }
     textureDB.CommitMultipleExecute();
+    CServiceBroker::GetTextureCache()->ClearLookupCache();
   }
 
   database.UpdateRepositoryContent(m_repo->ID(), m_repo->Version(), newChecksum, addons);
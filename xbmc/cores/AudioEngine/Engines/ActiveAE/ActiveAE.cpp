@@ -18,6 +18,7 @@
 #include "cores/AudioEngine/Utils/AEStreamData.h"
 #include "cores/AudioEngine/Utils/AEStreamInfo.h"
 #include "cores/AudioEngine/Utils/AEUtil.h"
+#include "cores/AudioEngine/Utils/AEVectorOps.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "utils/log.h"
@@ -1596,7 +1597,7 @@ void CActiveAE::ClearDiscardedBuffers()
       rbuf->Flush();
     }
     // if all buffers have returned, we can delete the buffer pool
-    if ((*it)->m_allSamples.size() == (*it)->m_freeSamples.size())
+    if ((*it)->m_allSamples.size() == (*it)->GetFreeCount())
     {
       CLog::Log(LOGDEBUG, "CActiveAE::ClearDiscardedBuffers - buffer pool deleted");
       it = m_discardBufferPools.erase(it);
@@ -1917,7 +1918,7 @@ bool CActiveAE::RunStages()
       if ((*it)->m_inputBuffers->m_format.m_dataFormat == AE_FMT_RAW)
         buftime = (*it)->m_inputBuffers->m_format.m_streamInfo.GetDuration() / 1000;
       while ((time < MAX_CACHE_LEVEL || (*it)->m_streamIsBuffering) &&
-             !(*it)->m_inputBuffers->m_freeSamples.empty())
+             (*it)->m_inputBuffers->HasFreeBuffer())
       {
         buffer = (*it)->m_inputBuffers->GetFreeBuffer();
         (*it)->m_processingSamples.push_back(buffer);
@@ -1962,7 +1963,7 @@ bool CActiveAE::RunStages()
       (m_mode == MODE_RAW && m_sinkFormat.m_streamInfo.m_type == CAEStreamInfo::STREAM_TYPE_TRUEHD);
 
   if ((m_stats.GetWaterLevel() < (MAX_WATER_LEVEL + 0.0001f) || isTrueHDPassthrough) &&
-      (m_mode != MODE_TRANSCODE || (m_encoderBuffers && !m_encoderBuffers->m_freeSamples.empty())))
+      (m_mode != MODE_TRANSCODE || (m_encoderBuffers && m_encoderBuffers->HasFreeBuffer())))
   {
     // calculate sync error
     for (it = m_streams.begin(); it != m_streams.end(); ++it)
@@ -2009,7 +2010,7 @@ bool CActiveAE::RunStages()
       CSampleBuffer *out = NULL;
       if (!m_sounds_playing.empty() && m_streams.empty())
       {
-        if (m_silenceBuffers && !m_silenceBuffers->m_freeSamples.empty())
+        if (m_silenceBuffers && m_silenceBuffers->HasFreeBuffer())
         {
           out = m_silenceBuffers->GetFreeBuffer();
           for (int i=0; i<out->pkt->planes; i++)
@@ -2061,6 +2062,7 @@ bool CActiveAE::RunStages()
 
             int nb_floats = out->pkt->nb_samples * out->pkt->config.channels / out->pkt->planes;
             int nb_loops = 1;
+            bool perFrame = false; // fading or limiter, even for a single frame
             float fadingStep = 0.0f;
 
             // fading
@@ -2080,6 +2082,7 @@ bool CActiveAE::RunStages()
             {
               nb_floats = out->pkt->config.channels / out->pkt->planes;
               nb_loops = out->pkt->nb_samples;
+              perFrame = true;
               float delta = (*it)->m_fadingTarget - (*it)->m_fadingBase;
               int samples = m_internalFormat.m_sampleRate * (float)(*it)->m_fadingTime / 1000.0f;
               fadingStep = delta / samples;
@@ -2094,39 +2097,26 @@ bool CActiveAE::RunStages()
             {
               nb_floats = out->pkt->config.channels / out->pkt->planes;
               nb_loops = out->pkt->nb_samples;
+              perFrame = true;
             }
 
-            for(int i=0; i<nb_loops; i++)
+            if (perFrame)
             {
-              if ((*it)->m_fadingSamples > 0)
+              CalcFrameGains(*it, *out->pkt, nb_loops, fadingStep);
+              for (int j = 0; j < out->pkt->planes; j++)
               {
-                (*it)->m_volume += fadingStep;
-                (*it)->m_fadingSamples--;
-
-                if ((*it)->m_fadingSamples == 0)
-                {
-                  // set variables being polled via stream interface
-                  std::unique_lock<CCriticalSection> lock((*it)->m_streamLock);
-                  (*it)->m_streamFading = false;
-                }
+                CAEVectorOps::MulFrameGains(reinterpret_cast<float*>(out->pkt->data[j]),
+                                            m_frameGains.data(), nb_loops, nb_floats);
               }
-
+            }
+            else
+            {
               // volume for stream
               float volume = (*it)->m_volume * (*it)->m_rgain;
-              if(nb_loops > 1)
-                volume *= (*it)->m_limiter.Run((float**)out->pkt->data, out->pkt->config.channels, i*nb_floats, out->pkt->planes > 1);
-
-              for(int j=0; j<out->pkt->planes; j++)
+              for (int j = 0; j < out->pkt->planes; j++)
               {
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulArray((float*)out->pkt->data[j]+i*nb_floats, volume, nb_floats);
-#else
-                float* fbuffer = (float*) out->pkt->data[j]+i*nb_floats;
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  fbuffer[k] *= volume;
-                }
-#endif
+                CAEVectorOps::MulArray(reinterpret_cast<float*>(out->pkt->data[j]), volume,
+                                       nb_floats);
               }
             }
           }
@@ -2138,6 +2128,7 @@ bool CActiveAE::RunStages()
 
             int nb_floats = mix->pkt->nb_samples * mix->pkt->config.channels / mix->pkt->planes;
             int nb_loops = 1;
+            bool perFrame = false; // fading or limiter, even for a single frame
             float fadingStep = 0.0f;
 
             // fading
@@ -2150,6 +2141,7 @@ bool CActiveAE::RunStages()
             {
               nb_floats = mix->pkt->config.channels / mix->pkt->planes;
               nb_loops = mix->pkt->nb_samples;
+              perFrame = true;
               float delta = (*it)->m_fadingTarget - (*it)->m_fadingBase;
               int samples = m_internalFormat.m_sampleRate * (float)(*it)->m_fadingTime / 1000.0f;
               fadingStep = delta / samples;
@@ -2161,50 +2153,31 @@ bool CActiveAE::RunStages()
             {
               nb_floats = out->pkt->config.channels / out->pkt->planes;
               nb_loops = out->pkt->nb_samples;
+              perFrame = true;
             }
 
-            for(int i=0; i<nb_loops; i++)
+            if (perFrame)
             {
-              if ((*it)->m_fadingSamples > 0)
+              CalcFrameGains(*it, *mix->pkt, nb_loops, fadingStep);
+              for (int j = 0; j < out->pkt->planes && j < mix->pkt->planes; j++)
               {
-                (*it)->m_volume += fadingStep;
-                (*it)->m_fadingSamples--;
-
-                if ((*it)->m_fadingSamples == 0)
-                {
-                  // set variables being polled via stream interface
-                  std::unique_lock<CCriticalSection> lock((*it)->m_streamLock);
-                  (*it)->m_streamFading = false;
-                }
+                float* dst = reinterpret_cast<float*>(out->pkt->data[j]);
+                float* src = reinterpret_cast<float*>(mix->pkt->data[j]);
+                if (CAEVectorOps::MulAddFrameGains(dst, src, m_frameGains.data(), nb_loops,
+                                                   nb_floats))
+                  needClamp = true;
               }
-
+            }
+            else
+            {
               // volume for stream
               float volume = (*it)->m_volume * (*it)->m_rgain;
-              if(nb_loops > 1)
-                volume *= (*it)->m_limiter.Run((float**)mix->pkt->data, mix->pkt->config.channels, i*nb_floats, mix->pkt->planes > 1);
-
-              for(int j=0; j<out->pkt->planes && j<mix->pkt->planes; j++)
+              for (int j = 0; j < out->pkt->planes && j < mix->pkt->planes; j++)
               {
-                float *dst = (float*)out->pkt->data[j]+i*nb_floats;
-                float *src = (float*)mix->pkt->data[j]+i*nb_floats;
-#if defined(HAVE_SSE) && defined(__SSE__)
-                CAEUtil::SSEMulAddArray(dst, src, volume, nb_floats);
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  if (fabs(dst[k]) > 1.0f)
-                  {
-                    needClamp = true;
-                    break;
-                  }
-                }
-#else
-                for (int k = 0; k < nb_floats; ++k)
-                {
-                  dst[k] += src[k] * volume;
-                  if (fabs(dst[k]) > 1.0f)
-                    needClamp = true;
-                }
-#endif
+                float* dst = reinterpret_cast<float*>(out->pkt->data[j]);
+                float* src = reinterpret_cast<float*>(mix->pkt->data[j]);
+                if (CAEVectorOps::MulAddArray(dst, src, volume, nb_floats))
+                  needClamp = true;
               }
             }
             mix->Return();
@@ -2239,7 +2212,7 @@ bool CActiveAE::RunStages()
               m_vizInitialized = true;
             }
 
-            if (!m_vizBuffersInput->m_freeSamples.empty())
+            if (m_vizBuffersInput->HasFreeBuffer())
             {
               // copy the samples into the viz input buffer
               CSampleBuffer *viz = m_vizBuffersInput->GetFreeBuffer();
@@ -2593,12 +2566,7 @@ void CActiveAE::MixSounds(CSoundPacket &dstSample)
       out = (float*)dstSample.data[j];
       sample_buffer = (float*)(it->sound->GetSound(false)->data[j]+start);
       int nb_floats = mix_samples * dstSample.config.channels / dstSample.planes;
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulAddArray(out, sample_buffer, volume, nb_floats);
-#else
-      for (int k = 0; k < nb_floats; ++k)
-        *out++ += *sample_buffer++ * volume;
-#endif
+      CAEVectorOps::MulAddArray(out, sample_buffer, volume, nb_floats);
     }
 
     it->samples_played += mix_samples;
@@ -2613,6 +2581,43 @@ void CActiveAE::MixSounds(CSoundPacket &dstSample)
   }
 }
 
+void CActiveAE::CalcFrameGains(CActiveAEStream* stream,
+                               const CSoundPacket& pkt,
+                               int frames,
+                               float fadingStep)
+{
+  const int channels = pkt.config.channels / pkt.planes;
+
+  // the limiter needs the highest sample of each frame before the gain is applied
+  m_framePeaks.assign(frames, 0.0f);
+  for (int j = 0; j < pkt.planes; j++)
+  {
+    CAEVectorOps::AccumulatePeaks(reinterpret_cast<const float*>(pkt.data[j]), frames, channels,
+                                  m_framePeaks.data());
+  }
+
+  m_frameGains.resize(frames);
+  for (int i = 0; i < frames; i++)
+  {
+    if (stream->m_fadingSamples > 0)
+    {
+      stream->m_volume += fadingStep;
+      stream->m_fadingSamples--;
+
+      if (stream->m_fadingSamples == 0)
+      {
+        // set variables being polled via stream interface
+        std::unique_lock<CCriticalSection> lock(stream->m_streamLock);
+        stream->m_streamFading = false;
+      }
+    }
+
+    // volume for stream
+    m_frameGains[i] =
+        stream->m_volume * stream->m_rgain * stream->m_limiter.RunPeak(m_framePeaks[i]);
+  }
+}
+
 void CActiveAE::Deamplify(CSoundPacket &dstSample)
 {
   if (m_volumeScaled < 1.0f || m_muted)
@@ -2623,13 +2628,7 @@ void CActiveAE::Deamplify(CSoundPacket &dstSample)
     for(int j=0; j<dstSample.planes; j++)
     {
       float* buffer = reinterpret_cast<float*>(dstSample.data[j]);
-#if defined(HAVE_SSE) && defined(__SSE__)
-      CAEUtil::SSEMulArray(buffer, volume, nb_floats);
-#else
-      float *fbuffer = buffer;
-      for (int i = 0; i < nb_floats; i++)
-        *fbuffer++ *= volume;
-#endif
+      CAEVectorOps::MulArray(buffer, volume, nb_floats);
     }
   }
 }
@@ -334,6 +334,10 @@ protected:
   bool ResampleSound(CActiveAESound *sound);
   void MixSounds(CSoundPacket &dstSample);
   void Deamplify(CSoundPacket &dstSample);
+  void CalcFrameGains(CActiveAEStream* stream,
+                      const CSoundPacket& pkt,
+                      int frames,
+                      float fadingStep);
 
   bool CompareFormat(const AEAudioFormat& lhs, const AEAudioFormat& rhs);
 
@@ -394,6 +398,10 @@ protected:
   std::list<SoundState> m_sounds_playing;
   std::vector<CActiveAESound*> m_sounds;
 
+  // per frame gains for streams that need volume changes within a packet
+  std::vector<float> m_frameGains;
+  std::vector<float> m_framePeaks;
+
   float m_volume; // volume on a 0..1 scale corresponding to a proportion along the dB scale
   float m_volumeScaled; // multiplier to scale samples in order to achieve the volume specified in m_volume
   bool m_muted;
@@ -33,14 +33,13 @@ CSoundPacket::~CSoundPacket()
 
 CSampleBuffer* CSampleBuffer::Acquire()
 {
-  refCount++;
+  refCount.fetch_add(1, std::memory_order_relaxed);
   return this;
 }
 
 void CSampleBuffer::Return()
 {
-  refCount--;
-  if (pool && refCount <= 0)
+  if (refCount.fetch_sub(1, std::memory_order_acq_rel) <= 1 && pool)
     pool->ReturnBuffer(this);
 }
 
@@ -57,26 +56,31 @@ CActiveAEBufferPool::CActiveAEBufferPool(const AEAudioFormat& format) : m_format
 
 CActiveAEBufferPool::~CActiveAEBufferPool()
 {
-  CSampleBuffer *buffer;
-  while(!m_allSamples.empty())
-  {
-    buffer = m_allSamples.front();
-    m_allSamples.pop_front();
+  for (CSampleBuffer* buffer : m_allSamples)
     delete buffer;
-  }
 }
 
 CSampleBuffer* CActiveAEBufferPool::GetFreeBuffer()
 {
-  CSampleBuffer* buf = NULL;
-
-  if (!m_freeSamples.empty())
+  uint64_t head = m_freeHead.load(std::memory_order_acquire);
+  CSampleBuffer* buf;
+  while (true)
   {
-    buf = m_freeSamples.front();
-    m_freeSamples.pop_front();
-    buf->refCount = 1;
-    buf->centerMixLevel = M_SQRT1_2;
+    const uint32_t top = static_cast<uint32_t>(head);
+    if (top == 0)
+      return nullptr;
+
+    buf = m_allSamples[top - 1];
+    const uint64_t next = (head & 0xFFFFFFFF00000000ULL) + (1ULL << 32) +
+                          static_cast<uint32_t>(buf->m_nextFree.load(std::memory_order_relaxed) + 1);
+    if (m_freeHead.compare_exchange_weak(head, next, std::memory_order_acquire,
+                                         std::memory_order_acquire))
+      break;
   }
+
+  m_freeCount.fetch_sub(1, std::memory_order_release);
+  buf->refCount.store(1, std::memory_order_relaxed);
+  buf->centerMixLevel = M_SQRT1_2;
   return buf;
 }
 
@@ -84,7 +88,19 @@ void CActiveAEBufferPool::ReturnBuffer(CSampleBuffer *buffer)
 {
   buffer->pkt->nb_samples = 0;
   buffer->pkt->pause_burst_ms = 0;
-  m_freeSamples.push_back(buffer);
+
+  uint64_t head = m_freeHead.load(std::memory_order_relaxed);
+  uint64_t next;
+  do
+  {
+    buffer->m_nextFree.store(static_cast<int>(static_cast<uint32_t>(head)) - 1,
+                             std::memory_order_relaxed);
+    next = (head & 0xFFFFFFFF00000000ULL) + (1ULL << 32) +
+           static_cast<uint32_t>(buffer->m_poolIndex + 1);
+  } while (!m_freeHead.compare_exchange_weak(head, next, std::memory_order_release,
+                                             std::memory_order_relaxed));
+
+  m_freeCount.fetch_add(1, std::memory_order_release);
 }
 
 bool CActiveAEBufferPool::Create(unsigned int totaltime)
@@ -110,9 +126,10 @@ bool CActiveAEBufferPool::Create(unsigned int totaltime)
     buffer = new CSampleBuffer();
     buffer->pool = this;
     buffer->pkt = std::make_unique<CSoundPacket>(config, m_format.m_frames);
+    buffer->m_poolIndex = static_cast<int>(m_allSamples.size());
 
     m_allSamples.push_back(buffer);
-    m_freeSamples.push_back(buffer);
+    ReturnBuffer(buffer);
     time += buffertime;
     n++;
   }
@@ -218,7 +235,7 @@ bool CActiveAEBufferPoolResample::ResampleBuffers(int64_t timestamp)
       busy = true;
     }
   }
-  else if (m_procSample || !m_freeSamples.empty())
+  else if (m_procSample || HasFreeBuffer())
   {
     int free_samples;
     if (m_procSample)
@@ -503,7 +520,7 @@ bool CActiveAEBufferPoolAtempo::ProcessBuffers()
       busy = true;
     }
   }
-  else if (m_procSample || !m_freeSamples.empty())
+  else if (m_procSample || HasFreeBuffer())
   {
     bool skipInput = false;
 
@@ -10,9 +10,11 @@
 
 #include "cores/AudioEngine/Utils/AEAudioFormat.h"
 #include "cores/AudioEngine/Interfaces/AE.h"
+#include <atomic>
 #include <cmath>
 #include <deque>
 #include <memory>
+#include <vector>
 
 extern "C" {
 #include <libavutil/avutil.h>
@@ -53,10 +55,22 @@ public:
   CActiveAEBufferPool *pool = nullptr;
   int64_t timestamp;
   int pkt_start_offset = 0;
-  int refCount = 0;
+  std::atomic<int> refCount{0};
   double centerMixLevel;
+
+private:
+  friend class CActiveAEBufferPool;
+  int m_poolIndex = -1;
+  std::atomic<int> m_nextFree{-1};
 };
 
+/*!
+ * \brief Fixed set of sample buffers
+ *
+ * The free list is a lock-free stack, so buffers can be returned from any thread (e.g. the
+ * sink) without blocking the engine thread. The set of buffers is fixed by Create, which
+ * must be done before any buffer is handed out.
+ */
 class CActiveAEBufferPool
 {
 public:
@@ -65,9 +79,15 @@ public:
   virtual bool Create(unsigned int totaltime);
   CSampleBuffer *GetFreeBuffer();
   void ReturnBuffer(CSampleBuffer *buffer);
+  bool HasFreeBuffer() const { return m_freeCount.load(std::memory_order_acquire) > 0; }
+  size_t GetFreeCount() const { return m_freeCount.load(std::memory_order_acquire); }
   AEAudioFormat m_format;
-  std::deque<CSampleBuffer*> m_allSamples;
-  std::deque<CSampleBuffer*> m_freeSamples;
+  std::vector<CSampleBuffer*> m_allSamples;
+
+private:
+  // index of the top buffer + 1 in the low half, ABA counter in the high half
+  std::atomic<uint64_t> m_freeHead{0};
+  std::atomic<int> m_freeCount{0};
 };
 
 class IAEResample;
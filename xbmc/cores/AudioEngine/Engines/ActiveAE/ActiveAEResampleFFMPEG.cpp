@@ -7,6 +7,7 @@
  */
 
 #include "cores/AudioEngine/Utils/AEUtil.h"
+#include "cores/AudioEngine/Utils/AEVectorOps.h"
 #include "ActiveAEResampleFFMPEG.h"
 #include "utils/log.h"
 
@@ -18,10 +19,27 @@ extern "C" {
 
 using namespace ActiveAE;
 
+namespace
+{
+bool IsFastConvertFormat(AVSampleFormat fmt)
+{
+  switch (av_get_packed_sample_fmt(fmt))
+  {
+    case AV_SAMPLE_FMT_FLT:
+    case AV_SAMPLE_FMT_S16:
+    case AV_SAMPLE_FMT_S32:
+      return true;
+    default:
+      return false;
+  }
+}
+} // namespace
+
 CActiveAEResampleFFMPEG::CActiveAEResampleFFMPEG()
 {
   m_pContext = NULL;
   m_doesResample = false;
+  m_fastConvert = false;
 }
 
 CActiveAEResampleFFMPEG::~CActiveAEResampleFFMPEG()
@@ -121,6 +139,9 @@ bool CActiveAEResampleFFMPEG::Init(SampleConfig dstConfig,
 
   av_opt_set_double(m_pContext, "center_mix_level", centerMix, 0);
 
+  // a pure sample format conversion between float and S16/S32 does not need swresample
+  bool identityMap = true;
+
   if (remapLayout)
   {
     // one-to-one mapping of channels
@@ -136,7 +157,11 @@ bool CActiveAEResampleFFMPEG::Init(SampleConfig dstConfig,
       {
         m_rematrix[out][idx] = 1.0;
       }
+      if (idx != static_cast<int>(out))
+        identityMap = false;
     }
+    if (static_cast<int>(remapLayout->Count()) != m_src_channels)
+      identityMap = false;
 
     av_opt_set_int(m_pContext, "out_channel_count", m_dst_channels, 0);
     av_opt_set_int(m_pContext, "out_channel_layout", m_dst_chan_layout, 0);
@@ -150,6 +175,7 @@ bool CActiveAEResampleFFMPEG::Init(SampleConfig dstConfig,
   // stereo upmix
   else if (upmix && m_src_channels == 2 && m_dst_channels > 2)
   {
+    identityMap = false;
     memset(m_rematrix, 0, sizeof(m_rematrix));
     av_channel_layout_uninit(&dstChLayout);
     av_channel_layout_from_mask(&dstChLayout, m_dst_chan_layout);
@@ -195,6 +221,42 @@ bool CActiveAEResampleFFMPEG::Init(SampleConfig dstConfig,
     CLog::Log(LOGERROR, "CActiveAEResampleFFMPEG::Init - init resampler failed");
     return false;
   }
+
+  const AVSampleFormat srcFmt = av_get_packed_sample_fmt(m_src_fmt);
+  const AVSampleFormat dstFmt = av_get_packed_sample_fmt(m_dst_fmt);
+  m_fastConvert = !m_doesResample && identityMap && m_src_channels == m_dst_channels &&
+                  (remapLayout || m_src_chan_layout == m_dst_chan_layout) &&
+                  av_sample_fmt_is_planar(m_src_fmt) == av_sample_fmt_is_planar(m_dst_fmt) &&
+                  IsFastConvertFormat(m_src_fmt) && IsFastConvertFormat(m_dst_fmt) &&
+                  srcFmt != dstFmt && (srcFmt == AV_SAMPLE_FMT_FLT || dstFmt == AV_SAMPLE_FMT_FLT);
+
+  return true;
+}
+
+bool CActiveAEResampleFFMPEG::FastConvert(uint8_t** dst_buffer, uint8_t** src_buffer, int samples)
+{
+  const AVSampleFormat srcFmt = av_get_packed_sample_fmt(m_src_fmt);
+  const AVSampleFormat dstFmt = av_get_packed_sample_fmt(m_dst_fmt);
+  const int planes = av_sample_fmt_is_planar(m_src_fmt) ? m_src_channels : 1;
+  const uint32_t count = samples * m_src_channels / planes;
+
+  for (int i = 0; i < planes; i++)
+  {
+    if (srcFmt == AV_SAMPLE_FMT_FLT && dstFmt == AV_SAMPLE_FMT_S16)
+      CAEVectorOps::FloatToS16(reinterpret_cast<const float*>(src_buffer[i]),
+                               reinterpret_cast<int16_t*>(dst_buffer[i]), count);
+    else if (srcFmt == AV_SAMPLE_FMT_FLT && dstFmt == AV_SAMPLE_FMT_S32)
+      CAEVectorOps::FloatToS32(reinterpret_cast<const float*>(src_buffer[i]),
+                               reinterpret_cast<int32_t*>(dst_buffer[i]), count);
+    else if (srcFmt == AV_SAMPLE_FMT_S16 && dstFmt == AV_SAMPLE_FMT_FLT)
+      CAEVectorOps::S16ToFloat(reinterpret_cast<const int16_t*>(src_buffer[i]),
+                               reinterpret_cast<float*>(dst_buffer[i]), count);
+    else if (srcFmt == AV_SAMPLE_FMT_S32 && dstFmt == AV_SAMPLE_FMT_FLT)
+      CAEVectorOps::S32ToFloat(reinterpret_cast<const int32_t*>(src_buffer[i]),
+                               reinterpret_cast<float*>(dst_buffer[i]), count);
+    else
+      return false;
+  }
   return true;
 }
 
@@ -218,8 +280,20 @@ int CActiveAEResampleFFMPEG::Resample(uint8_t **dst_buffer, int dst_samples, uin
     }
   }
 
-  //! @bug libavresample isn't const correct
-  int ret = swr_convert(m_pContext, dst_buffer, dst_samples, const_cast<const uint8_t**>(src_buffer), src_samples);
+  int ret;
+  // format only conversion, swresample would not buffer anything in this case
+  if (m_fastConvert && !m_doesResample && src_buffer && dst_samples >= src_samples &&
+      swr_get_delay(m_pContext, m_src_rate) == 0 &&
+      FastConvert(dst_buffer, src_buffer, src_samples))
+  {
+    ret = src_samples;
+  }
+  else
+  {
+    //! @bug libavresample isn't const correct
+    ret = swr_convert(m_pContext, dst_buffer, dst_samples,
+                      const_cast<const uint8_t**>(src_buffer), src_samples);
+  }
   if (ret < 0)
   {
     CLog::Log(LOGERROR, "CActiveAEResampleFFMPEG::Resample - resample failed");
@@ -45,8 +45,11 @@ public:
   int GetDstBufferSize(int samples) override;
 
 protected:
+  bool FastConvert(uint8_t** dst_buffer, uint8_t** src_buffer, int samples);
+
   bool m_loaded;
   bool m_doesResample;
+  bool m_fastConvert;
   uint64_t m_src_chan_layout, m_dst_chan_layout;
   int m_src_rate, m_dst_rate;
   int m_src_channels, m_dst_channels;
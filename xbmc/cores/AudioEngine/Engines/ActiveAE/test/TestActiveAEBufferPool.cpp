@@ -0,0 +1,158 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Engines/ActiveAE/ActiveAEBuffer.h"
+
+#include <array>
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace ActiveAE;
+
+namespace
+{
+AEAudioFormat GetFormat()
+{
+  AEAudioFormat format;
+  format.m_dataFormat = AE_FMT_FLOAT;
+  format.m_sampleRate = 48000;
+  format.m_channelLayout = AE_CH_LAYOUT_2_0;
+  format.m_frames = 480;
+  format.m_frameSize = 2 * sizeof(float);
+  return format;
+}
+} // namespace
+
+TEST(TestActiveAEBufferPool, GetAndReturn)
+{
+  CActiveAEBufferPool pool(GetFormat());
+  ASSERT_TRUE(pool.Create(100));
+
+  const size_t count = pool.m_allSamples.size();
+  EXPECT_GE(count, 5u);
+  EXPECT_EQ(pool.GetFreeCount(), count);
+
+  std::set<CSampleBuffer*> buffers;
+  while (CSampleBuffer* buffer = pool.GetFreeBuffer())
+  {
+    EXPECT_EQ(buffer->refCount, 1);
+    EXPECT_TRUE(buffers.insert(buffer).second);
+    buffer->pkt->nb_samples = 10;
+  }
+  EXPECT_EQ(buffers.size(), count);
+  EXPECT_FALSE(pool.HasFreeBuffer());
+
+  // a buffer goes back to the pool when the last reference is returned
+  CSampleBuffer* buffer = *buffers.begin();
+  buffer->Acquire();
+  buffer->Return();
+  EXPECT_FALSE(pool.HasFreeBuffer());
+  buffer->Return();
+  EXPECT_EQ(pool.GetFreeCount(), 1u);
+  EXPECT_EQ(buffer->pkt->nb_samples, 0);
+
+  for (CSampleBuffer* buf : buffers)
+  {
+    if (buf != buffer)
+      buf->Return();
+  }
+  EXPECT_EQ(pool.GetFreeCount(), count);
+}
+
+TEST(TestActiveAEBufferPool, ReturnFromSinkThreads)
+{
+  // the engine thread takes buffers from the pool while the sink threads hand them back,
+  // no buffer may be lost or handed out twice
+  constexpr int SINKS = 3;
+  constexpr int SLOTS = 4;
+  constexpr int PERIODS = 20000;
+
+  CActiveAEBufferPool pool(GetFormat());
+  ASSERT_TRUE(pool.Create(500));
+  const size_t count = pool.m_allSamples.size();
+
+  std::array<std::array<std::atomic<CSampleBuffer*>, SLOTS>, SINKS> slots{};
+  std::vector<std::atomic<int>> owners(count);
+  std::atomic<bool> stop{false};
+  std::atomic<int> errors{0};
+
+  auto index = [&pool](CSampleBuffer* buffer) {
+    for (size_t i = 0; i < pool.m_allSamples.size(); ++i)
+    {
+      if (pool.m_allSamples[i] == buffer)
+        return i;
+    }
+    return pool.m_allSamples.size();
+  };
+
+  std::vector<std::thread> sinks;
+  for (int s = 0; s < SINKS; ++s)
+  {
+    sinks.emplace_back([&, s]() {
+      while (!stop.load())
+      {
+        for (auto& slot : slots[s])
+        {
+          CSampleBuffer* buffer = slot.exchange(nullptr);
+          if (!buffer)
+            continue;
+          if (owners[index(buffer)].exchange(0) != 1)
+            errors++;
+          buffer->Return();
+        }
+        std::this_thread::yield();
+      }
+    });
+  }
+
+  int delivered = 0;
+  int period = 0;
+  while (delivered < PERIODS)
+  {
+    CSampleBuffer* buffer = pool.GetFreeBuffer();
+    if (!buffer)
+    {
+      std::this_thread::yield();
+      continue;
+    }
+
+    // every buffer must be handed out exactly once
+    if (owners[index(buffer)].exchange(1) != 0)
+      errors++;
+
+    auto& slot = slots[period % SINKS][(period / SINKS) % SLOTS];
+    CSampleBuffer* expected = nullptr;
+    while (!slot.compare_exchange_weak(expected, buffer))
+    {
+      expected = nullptr;
+      std::this_thread::yield();
+    }
+    delivered++;
+    period++;
+  }
+
+  while (pool.GetFreeCount() != count)
+    std::this_thread::yield();
+  stop = true;
+  for (auto& sink : sinks)
+    sink.join();
+
+  EXPECT_EQ(errors, 0);
+  EXPECT_EQ(pool.GetFreeCount(), count);
+
+  std::set<CSampleBuffer*> buffers;
+  while (CSampleBuffer* buffer = pool.GetFreeBuffer())
+    buffers.insert(buffer);
+  EXPECT_EQ(buffers.size(), count);
+  for (CSampleBuffer* buffer : buffers)
+    buffer->Return();
+}
@@ -40,4 +40,9 @@ class CAELimiter
     }
 
     float Run(float* frame[AE_CH_MAX], int channels, int offset = 0, bool planar = false);
+
+    /*!
+     * \brief Same as Run for a frame whose highest absolute sample value is already known
+     */
+    float RunPeak(float highest);
 };
@@ -0,0 +1,376 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "AEVectorOps.h"
+
+#include <algorithm>
+#include <math.h>
+
+#if defined(HAVE_SSE2) && defined(__SSE2__)
+#define AE_VECTOR_SSE2
+#include <emmintrin.h>
+#elif defined(HAS_NEON) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define AE_VECTOR_NEON
+#include <arm_neon.h>
+#if !defined(__aarch64__)
+#include "ServiceBroker.h"
+#include "utils/CPUInfo.h"
+#endif
+#endif
+
+namespace
+{
+constexpr float S16_SCALE = 32768.0f;
+constexpr float S32_SCALE = 2147483648.0f;
+
+#if defined(AE_VECTOR_NEON)
+bool HasNeon()
+{
+#if defined(__aarch64__)
+  return true;
+#else
+  static const bool neon = CServiceBroker::GetCPUInfo() &&
+                           (CServiceBroker::GetCPUInfo()->GetCPUFeatures() & CPU_FEATURE_NEON);
+  return neon;
+#endif
+}
+
+bool AnyLane(uint32x4_t mask)
+{
+  const uint32x2_t half = vorr_u32(vget_low_u32(mask), vget_high_u32(mask));
+  return (vget_lane_u32(half, 0) | vget_lane_u32(half, 1)) != 0;
+}
+#endif
+
+#if defined(AE_VECTOR_SSE2)
+inline __m128 Abs(__m128 value)
+{
+  return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+}
+
+inline float HorizontalMax(__m128 value)
+{
+  value = _mm_max_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(2, 3, 0, 1)));
+  value = _mm_max_ps(value, _mm_shuffle_ps(value, value, _MM_SHUFFLE(1, 0, 3, 2)));
+  return _mm_cvtss_f32(value);
+}
+#endif
+
+inline int16_t ConvertToS16(float value)
+{
+  const long sample = lrintf(value * S16_SCALE);
+  return static_cast<int16_t>(std::clamp(sample, -32768L, 32767L));
+}
+
+inline int32_t ConvertToS32(float value)
+{
+  const float sample = value * S32_SCALE;
+  if (sample >= S32_SCALE)
+    return INT32_MAX;
+  if (sample <= -S32_SCALE)
+    return INT32_MIN;
+  return static_cast<int32_t>(lrintf(sample));
+}
+} // namespace
+
+void CAEVectorOps::MulArray(float* data, float mul, uint32_t count)
+{
+  uint32_t i = 0;
+#if defined(AE_VECTOR_SSE2)
+  const __m128 m = _mm_set1_ps(mul);
+  for (; i + 4 <= count; i += 4)
+    _mm_storeu_ps(data + i, _mm_mul_ps(_mm_loadu_ps(data + i), m));
+#elif defined(AE_VECTOR_NEON)
+  if (HasNeon())
+  {
+    for (; i + 4 <= count; i += 4)
+      vst1q_f32(data + i, vmulq_n_f32(vld1q_f32(data + i), mul));
+  }
+#endif
+  for (; i < count; ++i)
+    data[i] *= mul;
+}
+
+bool CAEVectorOps::MulAddArray(float* data, const float* add, float mul, uint32_t count)
+{
+  bool clip = false;
+  uint32_t i = 0;
+#if defined(AE_VECTOR_SSE2)
+  const __m128 m = _mm_set1_ps(mul);
+  const __m128 one = _mm_set1_ps(1.0f);
+  __m128 over = _mm_setzero_ps();
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128 out =
+        _mm_add_ps(_mm_loadu_ps(data + i), _mm_mul_ps(_mm_loadu_ps(add + i), m));
+    over = _mm_or_ps(over, _mm_cmpgt_ps(Abs(out), one));
+    _mm_storeu_ps(data + i, out);
+  }
+  clip = _mm_movemask_ps(over) != 0;
+#elif defined(AE_VECTOR_NEON)
+  if (HasNeon())
+  {
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    uint32x4_t over = vdupq_n_u32(0);
+    for (; i + 4 <= count; i += 4)
+    {
+      const float32x4_t out = vmlaq_n_f32(vld1q_f32(data + i), vld1q_f32(add + i), mul);
+      over = vorrq_u32(over, vcagtq_f32(out, one));
+      vst1q_f32(data + i, out);
+    }
+    clip = AnyLane(over);
+  }
+#endif
+  for (; i < count; ++i)
+  {
+    data[i] += add[i] * mul;
+    if (fabsf(data[i]) > 1.0f)
+      clip = true;
+  }
+  return clip;
+}
+
+void CAEVectorOps::AccumulatePeaks(const float* data,
+                                   uint32_t frames,
+                                   uint32_t channels,
+                                   float* peaks)
+{
+  uint32_t i = 0;
+#if defined(AE_VECTOR_SSE2)
+  if (channels == 1)
+  {
+    for (; i + 4 <= frames; i += 4)
+      _mm_storeu_ps(peaks + i, _mm_max_ps(_mm_loadu_ps(peaks + i), Abs(_mm_loadu_ps(data + i))));
+  }
+  else if (channels % 4 == 0)
+  {
+    for (; i < frames; ++i)
+    {
+      const float* frame = data + i * channels;
+      __m128 peak = _mm_setzero_ps();
+      for (uint32_t c = 0; c < channels; c += 4)
+        peak = _mm_max_ps(peak, Abs(_mm_loadu_ps(frame + c)));
+      peaks[i] = std::max(peaks[i], HorizontalMax(peak));
+    }
+  }
+#elif defined(AE_VECTOR_NEON)
+  if (channels == 1 && HasNeon())
+  {
+    for (; i + 4 <= frames; i += 4)
+      vst1q_f32(peaks + i, vmaxq_f32(vld1q_f32(peaks + i), vabsq_f32(vld1q_f32(data + i))));
+  }
+#endif
+  for (; i < frames; ++i)
+  {
+    const float* frame = data + i * channels;
+    float peak = peaks[i];
+    for (uint32_t c = 0; c < channels; ++c)
+      peak = std::max(peak, fabsf(frame[c]));
+    peaks[i] = peak;
+  }
+}
+
+void CAEVectorOps::MulFrameGains(float* data,
+                                 const float* gains,
+                                 uint32_t frames,
+                                 uint32_t channels)
+{
+  uint32_t i = 0;
+#if defined(AE_VECTOR_SSE2)
+  if (channels == 1)
+  {
+    for (; i + 4 <= frames; i += 4)
+      _mm_storeu_ps(data + i, _mm_mul_ps(_mm_loadu_ps(data + i), _mm_loadu_ps(gains + i)));
+  }
+  else if (channels % 4 == 0)
+  {
+    for (; i < frames; ++i)
+    {
+      float* frame = data + i * channels;
+      const __m128 gain = _mm_set1_ps(gains[i]);
+      for (uint32_t c = 0; c < channels; c += 4)
+        _mm_storeu_ps(frame + c, _mm_mul_ps(_mm_loadu_ps(frame + c), gain));
+    }
+  }
+#elif defined(AE_VECTOR_NEON)
+  if (channels == 1 && HasNeon())
+  {
+    for (; i + 4 <= frames; i += 4)
+      vst1q_f32(data + i, vmulq_f32(vld1q_f32(data + i), vld1q_f32(gains + i)));
+  }
+#endif
+  for (; i < frames; ++i)
+  {
+    float* frame = data + i * channels;
+    for (uint32_t c = 0; c < channels; ++c)
+      frame[c] *= gains[i];
+  }
+}
+
+bool CAEVectorOps::MulAddFrameGains(
+    float* data, const float* add, const float* gains, uint32_t frames, uint32_t channels)
+{
+  bool clip = false;
+  uint32_t i = 0;
+#if defined(AE_VECTOR_SSE2)
+  const __m128 one = _mm_set1_ps(1.0f);
+  __m128 over = _mm_setzero_ps();
+  if (channels == 1)
+  {
+    for (; i + 4 <= frames; i += 4)
+    {
+      const __m128 out = _mm_add_ps(_mm_loadu_ps(data + i),
+                                    _mm_mul_ps(_mm_loadu_ps(add + i), _mm_loadu_ps(gains + i)));
+      over = _mm_or_ps(over, _mm_cmpgt_ps(Abs(out), one));
+      _mm_storeu_ps(data + i, out);
+    }
+  }
+  else if (channels % 4 == 0)
+  {
+    for (; i < frames; ++i)
+    {
+      float* frame = data + i * channels;
+      const float* addFrame = add + i * channels;
+      const __m128 gain = _mm_set1_ps(gains[i]);
+      for (uint32_t c = 0; c < channels; c += 4)
+      {
+        const __m128 out =
+            _mm_add_ps(_mm_loadu_ps(frame + c), _mm_mul_ps(_mm_loadu_ps(addFrame + c), gain));
+        over = _mm_or_ps(over, _mm_cmpgt_ps(Abs(out), one));
+        _mm_storeu_ps(frame + c, out);
+      }
+    }
+  }
+  clip = _mm_movemask_ps(over) != 0;
+#elif defined(AE_VECTOR_NEON)
+  if (channels == 1 && HasNeon())
+  {
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    uint32x4_t over = vdupq_n_u32(0);
+    for (; i + 4 <= frames; i += 4)
+    {
+      const float32x4_t out =
+          vmlaq_f32(vld1q_f32(data + i), vld1q_f32(add + i), vld1q_f32(gains + i));
+      over = vorrq_u32(over, vcagtq_f32(out, one));
+      vst1q_f32(data + i, out);
+    }
+    clip = AnyLane(over);
+  }
+#endif
+  for (; i < frames; ++i)
+  {
+    float* frame = data + i * channels;
+    const float* addFrame = add + i * channels;
+    for (uint32_t c = 0; c < channels; ++c)
+    {
+      frame[c] += addFrame[c] * gains[i];
+      if (fabsf(frame[c]) > 1.0f)
+        clip = true;
+    }
+  }
+  return clip;
+}
+
+void CAEVectorOps::FloatToS16(const float* src, int16_t* dst, uint32_t count)
+{
+  uint32_t i = 0;
+#if defined(AE_VECTOR_SSE2)
+  const __m128 scale = _mm_set1_ps(S16_SCALE);
+  const __m128 low = _mm_set1_ps(-32768.0f);
+  const __m128 high = _mm_set1_ps(32767.0f);
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128 a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i), scale), low), high);
+    const __m128 b =
+        _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(src + i + 4), scale), low), high);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm_packs_epi32(_mm_cvtps_epi32(a), _mm_cvtps_epi32(b)));
+  }
+#elif defined(AE_VECTOR_NEON) && defined(__aarch64__)
+  for (; i + 8 <= count; i += 8)
+  {
+    const int32x4_t a = vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(src + i), S16_SCALE));
+    const int32x4_t b = vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(src + i + 4), S16_SCALE));
+    vst1q_s16(dst + i, vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+  }
+#endif
+  for (; i < count; ++i)
+    dst[i] = ConvertToS16(src[i]);
+}
+
+void CAEVectorOps::FloatToS32(const float* src, int32_t* dst, uint32_t count)
+{
+  uint32_t i = 0;
+#if defined(AE_VECTOR_SSE2)
+  const __m128 scale = _mm_set1_ps(S32_SCALE);
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128 sample = _mm_mul_ps(_mm_loadu_ps(src + i), scale);
+    // cvtps returns 0x80000000 on overflow, flip it to INT32_MAX for positive values
+    const __m128i overflow = _mm_castps_si128(_mm_cmpge_ps(sample, scale));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i),
+                     _mm_xor_si128(_mm_cvtps_epi32(sample), overflow));
+  }
+#elif defined(AE_VECTOR_NEON) && defined(__aarch64__)
+  for (; i + 4 <= count; i += 4)
+    vst1q_s32(dst + i, vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(src + i), S32_SCALE)));
+#endif
+  for (; i < count; ++i)
+    dst[i] = ConvertToS32(src[i]);
+}
+
+void CAEVectorOps::S16ToFloat(const int16_t* src, float* dst, uint32_t count)
+{
+  constexpr float scale = 1.0f / S16_SCALE;
+  uint32_t i = 0;
+#if defined(AE_VECTOR_SSE2)
+  const __m128 m = _mm_set1_ps(scale);
+  for (; i + 8 <= count; i += 8)
+  {
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(in, in), 16);
+    const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(in, in), 16);
+    _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(lo), m));
+    _mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(hi), m));
+  }
+#elif defined(AE_VECTOR_NEON)
+  if (HasNeon())
+  {
+    for (; i + 8 <= count; i += 8)
+    {
+      const int16x8_t in = vld1q_s16(src + i);
+      vst1q_f32(dst + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(in))), scale));
+      vst1q_f32(dst + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(in))), scale));
+    }
+  }
+#endif
+  for (; i < count; ++i)
+    dst[i] = src[i] * scale;
+}
+
+void CAEVectorOps::S32ToFloat(const int32_t* src, float* dst, uint32_t count)
+{
+  constexpr float scale = 1.0f / S32_SCALE;
+  uint32_t i = 0;
+#if defined(AE_VECTOR_SSE2)
+  const __m128 m = _mm_set1_ps(scale);
+  for (; i + 4 <= count; i += 4)
+  {
+    const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_ps(dst + i, _mm_mul_ps(_mm_cvtepi32_ps(in), m));
+  }
+#elif defined(AE_VECTOR_NEON)
+  if (HasNeon())
+  {
+    for (; i + 4 <= count; i += 4)
+      vst1q_f32(dst + i, vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(src + i)), scale));
+  }
+#endif
+  for (; i < count; ++i)
+    dst[i] = src[i] * scale;
+}
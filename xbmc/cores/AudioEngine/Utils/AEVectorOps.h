@@ -0,0 +1,57 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+/*!
+ * \brief Vectorized sample processing kernels used by ActiveAE
+ *
+ * Uses SSE2 on x86 and NEON on ARM when available, the NEON path is selected at runtime
+ * through CCPUInfo on 32 bit ARM. All functions work on unaligned buffers and fall back
+ * to plain loops for the remaining samples.
+ */
+class CAEVectorOps
+{
+public:
+  /*! \brief data[i] *= mul */
+  static void MulArray(float* data, float mul, uint32_t count);
+
+  /*!
+   * \brief data[i] += add[i] * mul
+   * \return true if any of the resulting samples is outside [-1.0, 1.0]
+   */
+  static bool MulAddArray(float* data, const float* add, float mul, uint32_t count);
+
+  /*!
+   * \brief Track the highest absolute sample value of each frame
+   *
+   * peaks[i] = max(peaks[i], |data[i * channels + c]|) for all c < channels. Call it once per
+   * plane with channels = 1 for planar formats.
+   */
+  static void AccumulatePeaks(const float* data, uint32_t frames, uint32_t channels, float* peaks);
+
+  /*! \brief Apply a gain per frame, data[i * channels + c] *= gains[i] */
+  static void MulFrameGains(float* data, const float* gains, uint32_t frames, uint32_t channels);
+
+  /*!
+   * \brief Mix with a gain per frame, data[i * channels + c] += add[i * channels + c] * gains[i]
+   * \return true if any of the resulting samples is outside [-1.0, 1.0]
+   */
+  static bool MulAddFrameGains(
+      float* data, const float* add, const float* gains, uint32_t frames, uint32_t channels);
+
+  /*!
+   * \brief Sample format conversion, rounding and clipping like swresample
+   */
+  static void FloatToS16(const float* src, int16_t* dst, uint32_t count);
+  static void FloatToS32(const float* src, int32_t* dst, uint32_t count);
+  static void S16ToFloat(const int16_t* src, float* dst, uint32_t count);
+  static void S32ToFloat(const int32_t* src, float* dst, uint32_t count);
+};
@@ -0,0 +1,211 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/AudioEngine/Utils/AELimiter.h"
+#include "cores/AudioEngine/Utils/AEVectorOps.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::vector<float> RandomSamples(size_t count, float range)
+{
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<float> dist(-range, range);
+  std::vector<float> samples(count);
+  for (float& sample : samples)
+    sample = dist(gen);
+  return samples;
+}
+
+// allow for fused multiply-add in the reference loops
+void ExpectSamplesNear(const std::vector<float>& data, const std::vector<float>& ref)
+{
+  ASSERT_EQ(data.size(), ref.size());
+  for (size_t i = 0; i < data.size(); ++i)
+    EXPECT_NEAR(data[i], ref[i], 1e-6f) << "sample " << i;
+}
+} // namespace
+
+TEST(TestAEVectorOps, MulArray)
+{
+  // odd sizes and an unaligned start exercise the scalar tails
+  for (uint32_t count : {0u, 1u, 3u, 4u, 7u, 33u, 1023u})
+  {
+    std::vector<float> data = RandomSamples(count + 1, 1.0f);
+    std::vector<float> ref = data;
+
+    CAEVectorOps::MulArray(data.data() + 1, 0.5f, count);
+    for (uint32_t i = 0; i < count; ++i)
+      ref[i + 1] *= 0.5f;
+
+    EXPECT_EQ(data, ref) << "count " << count;
+  }
+}
+
+TEST(TestAEVectorOps, MulAddArrayDetectsClipping)
+{
+  for (uint32_t count : {1u, 5u, 64u, 101u})
+  {
+    std::vector<float> data = RandomSamples(count, 0.4f);
+    std::vector<float> add = RandomSamples(count, 0.4f);
+    std::vector<float> ref = data;
+
+    EXPECT_FALSE(CAEVectorOps::MulAddArray(data.data(), add.data(), 1.0f, count));
+    for (uint32_t i = 0; i < count; ++i)
+      ref[i] += add[i] * 1.0f;
+    ExpectSamplesNear(data, ref);
+
+    // a single sample over full scale anywhere, including the tail, has to be reported
+    data.assign(count, 0.0f);
+    add.assign(count, 0.0f);
+    add[count - 1] = -1.5f;
+    EXPECT_TRUE(CAEVectorOps::MulAddArray(data.data(), add.data(), 1.0f, count));
+
+    // exactly full scale does not need clamping
+    data.assign(count, 1.0f);
+    add.assign(count, 0.0f);
+    EXPECT_FALSE(CAEVectorOps::MulAddArray(data.data(), add.data(), 1.0f, count));
+  }
+}
+
+TEST(TestAEVectorOps, FrameGains)
+{
+  constexpr uint32_t frames = 37;
+  for (uint32_t channels : {1u, 2u, 3u, 6u, 8u})
+  {
+    const std::vector<float> gains = RandomSamples(frames, 1.0f);
+    std::vector<float> data = RandomSamples(frames * channels, 0.5f);
+    const std::vector<float> add = RandomSamples(frames * channels, 0.5f);
+
+    std::vector<float> peaks(frames, 0.0f);
+    CAEVectorOps::AccumulatePeaks(data.data(), frames, channels, peaks.data());
+    for (uint32_t i = 0; i < frames; ++i)
+    {
+      float peak = 0.0f;
+      for (uint32_t c = 0; c < channels; ++c)
+        peak = std::max(peak, std::fabs(data[i * channels + c]));
+      EXPECT_EQ(peaks[i], peak);
+    }
+
+    std::vector<float> ref = data;
+    CAEVectorOps::MulFrameGains(data.data(), gains.data(), frames, channels);
+    for (uint32_t i = 0; i < frames * channels; ++i)
+      ref[i] *= gains[i / channels];
+    ExpectSamplesNear(data, ref);
+
+    EXPECT_FALSE(
+        CAEVectorOps::MulAddFrameGains(data.data(), add.data(), gains.data(), frames, channels));
+    for (uint32_t i = 0; i < frames * channels; ++i)
+      ref[i] += add[i] * gains[i / channels];
+    ExpectSamplesNear(data, ref);
+  }
+}
+
+TEST(TestAEVectorOps, LimiterPeakMatchesRun)
+{
+  constexpr int channels = 6;
+  constexpr int frames = 64;
+  std::vector<float> data = RandomSamples(frames * channels, 1.5f);
+  std::vector<float> peaks(frames, 0.0f);
+  CAEVectorOps::AccumulatePeaks(data.data(), frames, channels, peaks.data());
+
+  CAELimiter limiter;
+  CAELimiter limiterPeak;
+  limiter.SetAmplification(2.0f);
+  limiterPeak.SetAmplification(2.0f);
+
+  float* planes[AE_CH_MAX] = {data.data()};
+  for (int i = 0; i < frames; ++i)
+    EXPECT_EQ(limiter.Run(planes, channels, i * channels), limiterPeak.RunPeak(peaks[i]));
+}
+
+TEST(TestAEVectorOps, Conversions)
+{
+  const std::vector<float> src = {0.0f,  1.0f,    -1.0f,       0.5f,       -0.5f,  1.5f,
+                                  -1.5f, 1e-6f,   0.99999994f, -0.999999f, 0.25f,  -0.75f,
+                                  2.0f,  -2.0f,   0.123456f,   -0.654321f, 0.001f, 0.9f};
+  const uint32_t count = src.size();
+
+  std::vector<int16_t> s16(count);
+  CAEVectorOps::FloatToS16(src.data(), s16.data(), count);
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    const long ref = std::clamp(lrintf(src[i] * 32768.0f), -32768L, 32767L);
+    EXPECT_EQ(s16[i], ref) << src[i];
+  }
+  EXPECT_EQ(s16[1], INT16_MAX);
+  EXPECT_EQ(s16[2], INT16_MIN);
+
+  std::vector<int32_t> s32(count);
+  CAEVectorOps::FloatToS32(src.data(), s32.data(), count);
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    const long long ref = std::clamp(llrintf(src[i] * 2147483648.0f),
+                                     static_cast<long long>(INT32_MIN),
+                                     static_cast<long long>(INT32_MAX));
+    EXPECT_EQ(s32[i], ref) << src[i];
+  }
+  EXPECT_EQ(s32[1], INT32_MAX);
+  EXPECT_EQ(s32[2], INT32_MIN);
+
+  std::vector<float> back(count);
+  CAEVectorOps::S16ToFloat(s16.data(), back.data(), count);
+  for (uint32_t i = 0; i < count; ++i)
+    EXPECT_EQ(back[i], s16[i] * (1.0f / 32768.0f));
+
+  CAEVectorOps::S32ToFloat(s32.data(), back.data(), count);
+  for (uint32_t i = 0; i < count; ++i)
+    EXPECT_EQ(back[i], s32[i] * (1.0f / 2147483648.0f));
+}
+
+TEST(TestAEVectorOps, FrameGainsAgainstScalar)
+{
+  constexpr uint32_t frames = 1024;
+  constexpr uint32_t channels = 8;
+  constexpr int ITERATIONS = 20;
+
+  const std::vector<float> gains = RandomSamples(frames, 1.0f);
+  const std::vector<float> add = RandomSamples(frames * channels, 0.5f);
+  std::vector<float> data(frames * channels, 0.0f);
+
+  // repeated mixes into the same buffer
+  bool clip = false;
+  for (int n = 0; n < ITERATIONS; ++n)
+  {
+    for (uint32_t i = 0; i < frames; ++i)
+    {
+      for (uint32_t c = 0; c < channels; ++c)
+      {
+        float& out = data[i * channels + c];
+        out += add[i * channels + c] * gains[i];
+        if (std::fabs(out) > 1.0f)
+          clip = true;
+        out *= 0.5f;
+      }
+    }
+  }
+  const std::vector<float> ref = data;
+
+  data.assign(frames * channels, 0.0f);
+  bool clipVector = false;
+  for (int n = 0; n < ITERATIONS; ++n)
+  {
+    clipVector |=
+        CAEVectorOps::MulAddFrameGains(data.data(), add.data(), gains.data(), frames, channels);
+    CAEVectorOps::MulArray(data.data(), 0.5f, frames * channels);
+  }
+
+  EXPECT_EQ(clip, clipVector);
+  ExpectSamplesNear(data, ref);
+}
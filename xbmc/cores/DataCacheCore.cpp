@@ -42,6 +42,10 @@ void CDataCacheCore::Reset()
     std::unique_lock<CCriticalSection> lock(m_audioPlayerSection);
     m_playerAudioInfo = {};
   }
+  {
+    std::unique_lock<CCriticalSection> lock(m_demuxSection);
+    m_demuxInfo = {};
+  }
   m_hasAVInfoChanges = false;
   {
     std::unique_lock<CCriticalSection> lock(m_renderSection);
@@ -260,6 +264,33 @@ int CDataCacheCore::GetAudioBitsPerSample()
   return m_playerAudioInfo.bitsPerSample;
 }
 
+void CDataCacheCore::SetDemuxPacketPoolStats(uint64_t hits, uint64_t misses, size_t cachedBytes)
+{
+  std::unique_lock<CCriticalSection> lock(m_demuxSection);
+
+  m_demuxInfo.packetPoolHits = hits;
+  m_demuxInfo.packetPoolMisses = misses;
+  m_demuxInfo.packetPoolCachedBytes = cachedBytes;
+}
+
+float CDataCacheCore::GetDemuxPacketPoolHitRate()
+{
+  std::unique_lock<CCriticalSection> lock(m_demuxSection);
+
+  const uint64_t total = m_demuxInfo.packetPoolHits + m_demuxInfo.packetPoolMisses;
+  if (total == 0)
+    return 0.0f;
+
+  return 100.0f * m_demuxInfo.packetPoolHits / total;
+}
+
+size_t CDataCacheCore::GetDemuxPacketPoolCachedBytes()
+{
+  std::unique_lock<CCriticalSection> lock(m_demuxSection);
+
+  return m_demuxInfo.packetPoolCachedBytes;
+}
+
 void CDataCacheCore::SetEditList(const std::vector<EDL::Edit>& editList)
 {
   std::unique_lock<CCriticalSection> lock(m_contentSection);
@@ -68,6 +68,28 @@ public:
   void SetAudioBitsPerSample(int bitsPerSample);
   int GetAudioBitsPerSample();
 
+  // demuxer info
+
+  /*!
+   * @brief Set the demux packet pool statistics in cache.
+   * @param hits Number of packet buffers served from the pool
+   * @param misses Number of packet buffers that had to be allocated
+   * @param cachedBytes Memory currently held by the pool
+   */
+  void SetDemuxPacketPoolStats(uint64_t hits, uint64_t misses, size_t cachedBytes);
+
+  /*!
+   * @brief Get the demux packet pool hit rate from cache.
+   * @return Percentage of packet buffers served from the pool
+   */
+  float GetDemuxPacketPoolHitRate();
+
+  /*!
+   * @brief Get the memory held by the demux packet pool from cache.
+   * @return Cached bytes
+   */
+  size_t GetDemuxPacketPoolCachedBytes();
+
   // content info
 
   /*!
@@ -222,6 +244,14 @@ protected:
     int bitsPerSample;
   } m_playerAudioInfo;
 
+  CCriticalSection m_demuxSection;
+  struct SDemuxInfo
+  {
+    uint64_t packetPoolHits;
+    uint64_t packetPoolMisses;
+    size_t packetPoolCachedBytes;
+  } m_demuxInfo{};
+
   mutable CCriticalSection m_contentSection;
   struct SContentInfo
   {
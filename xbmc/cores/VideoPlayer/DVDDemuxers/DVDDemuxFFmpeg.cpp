@@ -104,6 +104,15 @@ bool AttachmentIsFont(const AVDictionaryEntry* dict)
   }
   return false;
 }
+
+DemuxPacket* CreateDemuxPacket(const AVPacket& pkt)
+{
+  // reference counted payloads are handed on without copying them
+  DemuxPacket* packet = CDVDDemuxUtils::WrapAVPacket(&pkt);
+  if (!packet)
+    packet = CDVDDemuxUtils::AllocateDemuxPacket(pkt.size);
+  return packet;
+}
 } // namespace
 
 std::string CDemuxStreamAudioFFmpeg::GetStreamName()
@@ -1113,7 +1122,7 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
               if (m_pkt.pkt.stream_index ==
                   (int)m_pFormatContext->programs[m_program]->stream_index[i])
               {
-                pPacket = CDVDDemuxUtils::AllocateDemuxPacket(m_pkt.pkt.size);
+                pPacket = CreateDemuxPacket(m_pkt.pkt);
                 break;
               }
             }
@@ -1122,7 +1131,7 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
               bReturnEmpty = true;
           }
           else
-            pPacket = CDVDDemuxUtils::AllocateDemuxPacket(m_pkt.pkt.size);
+            pPacket = CreateDemuxPacket(m_pkt.pkt);
         }
         else
           bReturnEmpty = true;
@@ -1136,11 +1145,10 @@ DemuxPacket* CDVDDemuxFFmpeg::ReadInternal(bool keep)
             m_pkt.pkt.pts = AV_NOPTS_VALUE;
           }
 
-          // copy contents into our own packet
+          // copy contents into our own packet unless it references the ffmpeg buffer
           pPacket->iSize = m_pkt.pkt.size;
 
-          // maybe we can avoid a memcpy here by detecting where pkt.destruct is pointing too?
-          if (m_pkt.pkt.data)
+          if (m_pkt.pkt.data && !pPacket->m_avBuffer)
             memcpy(pPacket->pData, m_pkt.pkt.data, pPacket->iSize);
 
           pPacket->pts =
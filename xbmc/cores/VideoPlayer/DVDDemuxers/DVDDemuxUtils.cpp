@@ -8,8 +8,8 @@
 
 #include "DVDDemuxUtils.h"
 
+#include "DemuxPacketPool.h"
 #include "cores/VideoPlayer/Interface/DemuxCrypto.h"
-#include "utils/MemUtils.h"
 #include "utils/log.h"
 
 extern "C" {
@@ -20,8 +20,10 @@ void CDVDDemuxUtils::FreeDemuxPacket(DemuxPacket* pPacket)
 {
   if (pPacket)
   {
-    if (pPacket->pData)
-      KODI::MEMORY::AlignedFree(pPacket->pData);
+    if (pPacket->m_avBuffer)
+      av_buffer_unref(&pPacket->m_avBuffer);
+    else if (pPacket->pData)
+      CDemuxPacketPool::GetInstance().ReleaseData(pPacket->pData, pPacket->m_dataCapacity);
     if (pPacket->iSideDataElems)
     {
       AVPacket* avPkt = av_packet_alloc();
@@ -45,13 +47,13 @@ void CDVDDemuxUtils::FreeDemuxPacket(DemuxPacket* pPacket)
     }
     if (pPacket->cryptoInfo)
       delete pPacket->cryptoInfo;
-    delete pPacket;
+    CDemuxPacketPool::GetInstance().ReleasePacket(pPacket);
   }
 }
 
 DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(int iDataSize)
 {
-  DemuxPacket* pPacket = new DemuxPacket();
+  DemuxPacket* pPacket = CDemuxPacketPool::GetInstance().AcquirePacket();
 
   if (iDataSize > 0)
   {
@@ -64,7 +66,8 @@ DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(int iDataSize)
      * Note, if the first 23 bits of the additional bytes are not 0 then damaged
      * MPEG bitstreams could cause overread and segfault
      */
-    pPacket->pData = static_cast<uint8_t*>(KODI::MEMORY::AlignedMalloc(iDataSize + AV_INPUT_BUFFER_PADDING_SIZE, 16));
+    pPacket->pData = CDemuxPacketPool::GetInstance().AcquireData(
+        iDataSize + AV_INPUT_BUFFER_PADDING_SIZE, pPacket->m_dataCapacity);
     if (!pPacket->pData)
     {
       FreeDemuxPacket(pPacket);
@@ -86,6 +89,42 @@ DemuxPacket* CDVDDemuxUtils::AllocateDemuxPacket(unsigned int iDataSize, unsigne
   return ret;
 }
 
+DemuxPacket* CDVDDemuxUtils::WrapAVPacket(const AVPacket* src)
+{
+  if (!src->buf || !src->data)
+    return nullptr;
+
+  DemuxPacket* pPacket = AllocateDemuxPacket(0);
+  if (!pPacket)
+    return nullptr;
+
+  pPacket->m_avBuffer = av_buffer_ref(src->buf);
+  if (!pPacket->m_avBuffer)
+  {
+    FreeDemuxPacket(pPacket);
+    return nullptr;
+  }
+
+  pPacket->pData = src->data;
+  pPacket->iSize = src->size;
+
+  return pPacket;
+}
+
+AVBufferRef* CDVDDemuxUtils::RefPacketBuffer(const DemuxPacket& pkt)
+{
+  if (!pkt.m_avBuffer || !pkt.pData)
+    return nullptr;
+
+  // make sure nobody pointed pData somewhere else since the packet was created
+  const uint8_t* begin = pkt.m_avBuffer->data;
+  const uint8_t* end = begin + pkt.m_avBuffer->size;
+  if (pkt.pData < begin || pkt.pData + pkt.iSize > end)
+    return nullptr;
+
+  return av_buffer_ref(pkt.m_avBuffer);
+}
+
 void CDVDDemuxUtils::StoreSideData(DemuxPacket *pkt, AVPacket *src)
 {
   AVPacket* avPkt = av_packet_alloc();
@@ -20,5 +20,21 @@ public:
   static DemuxPacket* AllocateDemuxPacket(int iDataSize = 0);
   static DemuxPacket* AllocateDemuxPacket(unsigned int iDataSize, unsigned int encryptedSubsampleCount);
   static void StoreSideData(DemuxPacket *pkt, AVPacket *src);
+
+  /*!
+   * \brief Allocate a packet referencing the payload of a reference counted AVPacket
+   *
+   * The payload is not copied, the packet holds a reference to src->buf until it is freed.
+   * \return the packet or nullptr if src is not reference counted
+   */
+  static DemuxPacket* WrapAVPacket(const AVPacket* src);
+
+  /*!
+   * \brief Get a new reference to the ffmpeg buffer holding the payload of pkt
+   *
+   * Lets decoders pass the payload on to avcodec_send_packet without ffmpeg copying it.
+   * \return the reference or nullptr if the payload is not owned by an AVBufferRef
+   */
+  static AVBufferRef* RefPacketBuffer(const DemuxPacket& pkt);
 };
 
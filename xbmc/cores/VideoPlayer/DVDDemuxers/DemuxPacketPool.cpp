@@ -0,0 +1,174 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "DemuxPacketPool.h"
+
+#include "cores/VideoPlayer/Interface/DemuxPacket.h"
+#include "utils/MemUtils.h"
+
+#include <algorithm>
+#include <mutex>
+
+namespace
+{
+constexpr size_t MIN_CLASS_SIZE = 1024;
+constexpr size_t MAX_CLASS_SIZE = 8 * 1024 * 1024;
+constexpr size_t DEFAULT_MAX_CACHED_BYTES = 16 * 1024 * 1024;
+constexpr size_t MAX_CACHED_PACKETS = 1024;
+constexpr size_t DATA_ALIGNMENT = 16;
+} // namespace
+
+CDemuxPacketPool& CDemuxPacketPool::GetInstance()
+{
+  static CDemuxPacketPool pool(DEFAULT_MAX_CACHED_BYTES);
+  return pool;
+}
+
+CDemuxPacketPool::CDemuxPacketPool(size_t maxCachedBytes) : m_maxCachedBytes(maxCachedBytes)
+{
+  // four classes per power of two keeps the slack per buffer below 25%
+  for (size_t base = MIN_CLASS_SIZE; base < MAX_CLASS_SIZE; base *= 2)
+  {
+    for (size_t step = 0; step < 4; ++step)
+      m_classSizes.push_back(base + base / 4 * step);
+  }
+  m_classSizes.push_back(MAX_CLASS_SIZE);
+
+  m_freeData.resize(m_classSizes.size());
+}
+
+CDemuxPacketPool::~CDemuxPacketPool()
+{
+  Trim();
+}
+
+DemuxPacket* CDemuxPacketPool::AcquirePacket()
+{
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    if (!m_freePackets.empty())
+    {
+      DemuxPacket* packet = m_freePackets.back();
+      m_freePackets.pop_back();
+      lock.unlock();
+
+      *packet = DemuxPacket();
+      return packet;
+    }
+  }
+
+  return new DemuxPacket();
+}
+
+void CDemuxPacketPool::ReleasePacket(DemuxPacket* packet)
+{
+  if (!packet)
+    return;
+
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    if (m_freePackets.size() < MAX_CACHED_PACKETS)
+    {
+      m_freePackets.push_back(packet);
+      return;
+    }
+  }
+
+  delete packet;
+}
+
+uint8_t* CDemuxPacketPool::AcquireData(size_t size, size_t& capacity)
+{
+  const int sizeClass = GetSizeClass(size);
+  if (sizeClass < 0)
+  {
+    m_misses++;
+    capacity = size;
+    return static_cast<uint8_t*>(KODI::MEMORY::AlignedMalloc(size, DATA_ALIGNMENT));
+  }
+
+  capacity = m_classSizes[sizeClass];
+
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    std::vector<uint8_t*>& freeList = m_freeData[sizeClass];
+    if (!freeList.empty())
+    {
+      uint8_t* data = freeList.back();
+      freeList.pop_back();
+      m_cachedBytes -= capacity;
+      m_hits++;
+      return data;
+    }
+  }
+
+  m_misses++;
+  return static_cast<uint8_t*>(KODI::MEMORY::AlignedMalloc(capacity, DATA_ALIGNMENT));
+}
+
+void CDemuxPacketPool::ReleaseData(uint8_t* data, size_t capacity)
+{
+  if (!data)
+    return;
+
+  const int sizeClass = GetSizeClass(capacity);
+  if (sizeClass >= 0 && m_classSizes[sizeClass] == capacity)
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    if (m_cachedBytes + capacity <= m_maxCachedBytes)
+    {
+      m_freeData[sizeClass].push_back(data);
+      m_cachedBytes += capacity;
+      return;
+    }
+  }
+
+  KODI::MEMORY::AlignedFree(data);
+}
+
+void CDemuxPacketPool::Trim()
+{
+  std::vector<std::vector<uint8_t*>> freeData(m_freeData.size());
+  std::vector<DemuxPacket*> freePackets;
+
+  {
+    std::unique_lock<CCriticalSection> lock(m_section);
+    freeData.swap(m_freeData);
+    freePackets.swap(m_freePackets);
+    m_cachedBytes = 0;
+  }
+
+  for (const auto& freeList : freeData)
+  {
+    for (uint8_t* data : freeList)
+      KODI::MEMORY::AlignedFree(data);
+  }
+
+  for (DemuxPacket* packet : freePackets)
+    delete packet;
+}
+
+CDemuxPacketPool::Stats CDemuxPacketPool::GetStats() const
+{
+  Stats stats;
+  stats.hits = m_hits;
+  stats.misses = m_misses;
+
+  std::unique_lock<CCriticalSection> lock(m_section);
+  stats.cachedBytes = m_cachedBytes;
+  return stats;
+}
+
+int CDemuxPacketPool::GetSizeClass(size_t size) const
+{
+  if (size > MAX_CLASS_SIZE)
+    return -1;
+
+  auto it = std::lower_bound(m_classSizes.begin(), m_classSizes.end(), size);
+  return static_cast<int>(std::distance(m_classSizes.begin(), it));
+}
@@ -0,0 +1,88 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct DemuxPacket;
+
+/*!
+ * \brief Recycles DemuxPacket structs and their payload buffers.
+ *
+ * Payloads are rounded up to a set of size classes (four per power of two) so a
+ * buffer released by a decoder thread can be handed out again for the next packet
+ * of similar size. The amount of memory kept in the free lists is bounded, anything
+ * above the budget or above the largest class goes straight back to the system.
+ */
+class CDemuxPacketPool
+{
+public:
+  struct Stats
+  {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t cachedBytes = 0;
+  };
+
+  static CDemuxPacketPool& GetInstance();
+
+  explicit CDemuxPacketPool(size_t maxCachedBytes);
+  ~CDemuxPacketPool();
+
+  CDemuxPacketPool(const CDemuxPacketPool&) = delete;
+  CDemuxPacketPool& operator=(const CDemuxPacketPool&) = delete;
+
+  /*!
+   * \brief Get a default constructed packet
+   */
+  DemuxPacket* AcquirePacket();
+
+  /*!
+   * \brief Return a packet, payload and side data must have been released already
+   */
+  void ReleasePacket(DemuxPacket* packet);
+
+  /*!
+   * \brief Get a 16 byte aligned buffer of at least size bytes
+   * \param size requested size in bytes
+   * \param[out] capacity real size of the buffer, needed to release it again
+   * \return the buffer or nullptr if out of memory
+   */
+  uint8_t* AcquireData(size_t size, size_t& capacity);
+
+  /*!
+   * \brief Return a buffer obtained by AcquireData
+   */
+  void ReleaseData(uint8_t* data, size_t capacity);
+
+  /*!
+   * \brief Free all cached packets and buffers
+   */
+  void Trim();
+
+  Stats GetStats() const;
+
+private:
+  int GetSizeClass(size_t size) const;
+
+  mutable CCriticalSection m_section;
+  const size_t m_maxCachedBytes;
+  size_t m_cachedBytes = 0;
+  std::vector<size_t> m_classSizes;
+  std::vector<std::vector<uint8_t*>> m_freeData;
+  std::vector<DemuxPacket*> m_freePackets;
+
+  std::atomic<uint64_t> m_hits{0};
+  std::atomic<uint64_t> m_misses{0};
+};
@@ -17,7 +17,18 @@
 
 using namespace std::chrono_literals;
 
-CDVDMessageQueue::CDVDMessageQueue(const std::string &owner) : m_hEvent(true), m_owner(owner)
+namespace
+{
+// initial slots of the packet ring, enough for a few seconds of high bitrate audio
+constexpr size_t MESSAGES_CAPACITY = 1024;
+constexpr size_t PRIO_MESSAGES_CAPACITY = 16;
+} // namespace
+
+CDVDMessageQueue::CDVDMessageQueue(const std::string& owner)
+  : m_hEvent(true),
+    m_owner(owner),
+    m_messages(MESSAGES_CAPACITY),
+    m_prioMessages(PRIO_MESSAGES_CAPACITY)
 {
   m_iDataSize     = 0;
   m_bInitialized = false;
@@ -48,11 +59,11 @@ void CDVDMessageQueue::Flush(CDVDMsg::Message type)
 {
   std::unique_lock<CCriticalSection> lock(m_section);
 
-  m_messages.remove_if([type](const DVDMessageListItem &item){
+  m_messages.RemoveIf([type](const DVDMessageListItem& item) {
     return type == CDVDMsg::NONE || item.message->IsType(type);
   });
 
-  m_prioMessages.remove_if([type](const DVDMessageListItem &item){
+  m_prioMessages.RemoveIf([type](const DVDMessageListItem& item) {
     return type == CDVDMsg::NONE || item.message->IsType(type);
   });
 
@@ -118,15 +129,14 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     if (!front)
       prio++;
 
-    auto it = std::find_if(m_prioMessages.begin(), m_prioMessages.end(),
-                           [prio](const DVDMessageListItem &item){
-                             return prio <= item.priority;
-                           });
-    m_prioMessages.emplace(it, pMsg, priority);
+    size_t pos = 0;
+    while (pos < m_prioMessages.Size() && prio > m_prioMessages.At(pos).priority)
+      pos++;
+    m_prioMessages.Emplace(pos, pMsg, priority);
   }
   else
   {
-    if (m_messages.empty())
+    if (m_messages.Empty())
     {
       m_iDataSize = 0;
       m_TimeBack = DVD_NOPTS_VALUE;
@@ -134,9 +144,9 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     }
 
     if (front)
-      m_messages.emplace_front(pMsg, priority);
+      m_messages.EmplaceFront(pMsg, priority);
     else
-      m_messages.emplace_back(pMsg, priority);
+      m_messages.EmplaceBack(pMsg, priority);
   }
 
   if (pMsg->IsType(CDVDMsg::DEMUXER_PACKET) && priority == 0)
@@ -152,8 +162,9 @@ MsgQueueReturnCode CDVDMessageQueue::Put(const std::shared_ptr<CDVDMsg>& pMsg,
     }
   }
 
-  // inform waiter for new packet
-  m_hEvent.Set();
+  // inform waiter for new packet, the event round trip is skipped while nobody is blocked in Get
+  if (m_waiting > 0)
+    m_hEvent.Set();
 
   return MSGQ_OK;
 }
@@ -174,11 +185,12 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
 
   while (!m_bAbortRequest)
   {
-    std::list<DVDMessageListItem> &msgs = (priority > 0 || !m_prioMessages.empty()) ? m_prioMessages : m_messages;
+    CDVDMessageRing<DVDMessageListItem>& msgs =
+        (priority > 0 || !m_prioMessages.Empty()) ? m_prioMessages : m_messages;
 
-    if (!msgs.empty() && (msgs.back().priority >= priority || m_drain))
+    if (!msgs.Empty() && (msgs.Back().priority >= priority || m_drain))
     {
-      DVDMessageListItem& item(msgs.back());
+      DVDMessageListItem& item(msgs.Back());
       priority = item.priority;
 
       if (item.message->IsType(CDVDMsg::DEMUXER_PACKET) && item.priority == 0)
@@ -192,7 +204,7 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
       }
 
       pMsg = std::move(item.message);
-      msgs.pop_back();
+      msgs.PopBack();
       UpdateTimeBack();
       ret = MSGQ_OK;
       break;
@@ -205,13 +217,17 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
     else
     {
       m_hEvent.Reset();
+      m_waiting++;
       lock.unlock();
 
       // wait for a new message
-      if (!m_hEvent.Wait(timeout))
-        return MSGQ_TIMEOUT;
+      const bool signaled = m_hEvent.Wait(timeout);
 
       lock.lock();
+      m_waiting--;
+
+      if (!signaled)
+        return MSGQ_TIMEOUT;
     }
   }
 
@@ -223,9 +239,9 @@ MsgQueueReturnCode CDVDMessageQueue::Get(std::shared_ptr<CDVDMsg>& pMsg,
 
 void CDVDMessageQueue::UpdateTimeFront()
 {
-  if (!m_messages.empty())
+  if (!m_messages.Empty())
   {
-    auto &item = m_messages.front();
+    auto& item = m_messages.Front();
     if (item.message->IsType(CDVDMsg::DEMUXER_PACKET))
     {
       DemuxPacket* packet =
@@ -246,9 +262,9 @@ void CDVDMessageQueue::UpdateTimeFront()
 
 void CDVDMessageQueue::UpdateTimeBack()
 {
-  if (!m_messages.empty())
+  if (!m_messages.Empty())
   {
-    auto &item = m_messages.back();
+    auto& item = m_messages.Back();
     if (item.message->IsType(CDVDMsg::DEMUXER_PACKET))
     {
       DemuxPacket* packet =
@@ -275,14 +291,14 @@ unsigned CDVDMessageQueue::GetPacketCount(CDVDMsg::Message type)
     return 0;
 
   unsigned count = 0;
-  for (const auto &item : m_messages)
+  for (size_t i = 0; i < m_messages.Size(); ++i)
   {
-    if(item.message->IsType(type))
+    if (m_messages.At(i).message->IsType(type))
       count++;
   }
-  for (const auto &item : m_prioMessages)
+  for (size_t i = 0; i < m_prioMessages.Size(); ++i)
   {
-    if(item.message->IsType(type))
+    if (m_prioMessages.At(i).message->IsType(type))
       count++;
   }
 
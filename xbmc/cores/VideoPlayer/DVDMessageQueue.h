@@ -9,12 +9,12 @@
 #pragma once
 
 #include "DVDMessage.h"
+#include "DVDMessageRing.h"
 #include "threads/CriticalSection.h"
 #include "threads/Event.h"
 
 #include <algorithm>
 #include <atomic>
-#include <list>
 #include <string>
 
 struct DVDMessageListItem
@@ -25,9 +25,11 @@ struct DVDMessageListItem
   }
   DVDMessageListItem() { priority = 0; }
   DVDMessageListItem(const DVDMessageListItem&) = delete;
+  DVDMessageListItem(DVDMessageListItem&&) = default;
   ~DVDMessageListItem() = default;
 
   DVDMessageListItem& operator=(const DVDMessageListItem&) = delete;
+  DVDMessageListItem& operator=(DVDMessageListItem&&) = default;
 
   std::shared_ptr<CDVDMsg> message;
   int priority;
@@ -101,6 +103,7 @@ private:
   std::atomic<bool> m_bAbortRequest = false;
   bool m_bInitialized;
   bool m_drain = false;
+  int m_waiting = 0;
 
   int m_iDataSize;
   double m_TimeFront;
@@ -110,7 +113,7 @@ private:
   int m_iMaxDataSize;
   std::string m_owner;
 
-  std::list<DVDMessageListItem> m_messages;
-  std::list<DVDMessageListItem> m_prioMessages;
+  CDVDMessageRing<DVDMessageListItem> m_messages;
+  CDVDMessageRing<DVDMessageListItem> m_prioMessages;
 };
 
@@ -0,0 +1,135 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/*!
+ * \brief Preallocated double ended ring used as storage for CDVDMessageQueue.
+ *
+ * The queue pushes new messages at the front and pops them from the back, so a
+ * std::list costs one node allocation per demuxed packet. This ring keeps its slots
+ * across Flush() calls and only reallocates (doubling the capacity) when more items
+ * are queued than ever before, so the steady state does not touch the allocator.
+ *
+ * Not thread safe, the owner is responsible for locking.
+ */
+template<typename T>
+class CDVDMessageRing
+{
+public:
+  explicit CDVDMessageRing(size_t capacity = 0) { Reserve(capacity); }
+
+  bool Empty() const { return m_count == 0; }
+  size_t Size() const { return m_count; }
+  size_t Capacity() const { return m_items.size(); }
+
+  /*!
+   * \brief Make sure at least capacity items fit without reallocation
+   */
+  void Reserve(size_t capacity)
+  {
+    if (capacity <= m_items.size())
+      return;
+
+    size_t size = m_items.empty() ? 16 : m_items.size();
+    while (size < capacity)
+      size *= 2;
+
+    std::vector<T> items(size);
+    for (size_t i = 0; i < m_count; ++i)
+      items[i] = std::move(At(i));
+
+    m_items = std::move(items);
+    m_first = 0;
+  }
+
+  T& Front() { return At(0); }
+  const T& Front() const { return At(0); }
+  T& Back() { return At(m_count - 1); }
+  const T& Back() const { return At(m_count - 1); }
+
+  /*!
+   * \brief Access items in queue order, index 0 is the front
+   */
+  T& At(size_t index) { return m_items[(m_first + index) & (m_items.size() - 1)]; }
+  const T& At(size_t index) const
+  {
+    return m_items[(m_first + index) & (m_items.size() - 1)];
+  }
+
+  template<typename... Args>
+  void EmplaceFront(Args&&... args)
+  {
+    Grow();
+    m_first = (m_first - 1) & (m_items.size() - 1);
+    m_items[m_first] = T(std::forward<Args>(args)...);
+    m_count++;
+  }
+
+  template<typename... Args>
+  void EmplaceBack(Args&&... args)
+  {
+    Grow();
+    m_items[(m_first + m_count) & (m_items.size() - 1)] = T(std::forward<Args>(args)...);
+    m_count++;
+  }
+
+  /*!
+   * \brief Insert before the item at position index, index == Size() appends at the back
+   */
+  template<typename... Args>
+  void Emplace(size_t index, Args&&... args)
+  {
+    EmplaceBack(std::forward<Args>(args)...);
+    for (size_t i = m_count - 1; i > index; --i)
+      std::swap(At(i), At(i - 1));
+  }
+
+  void PopBack()
+  {
+    At(m_count - 1) = T();
+    m_count--;
+  }
+
+  /*!
+   * \brief Remove all items matching pred, keeping the order of the remaining ones
+   */
+  template<typename Pred>
+  void RemoveIf(Pred pred)
+  {
+    size_t kept = 0;
+    for (size_t i = 0; i < m_count; ++i)
+    {
+      if (pred(At(i)))
+        continue;
+      if (kept != i)
+        At(kept) = std::move(At(i));
+      kept++;
+    }
+    for (size_t i = kept; i < m_count; ++i)
+      At(i) = T();
+    m_count = kept;
+  }
+
+  void Clear() { RemoveIf([](const T&) { return true; }); }
+
+private:
+  void Grow()
+  {
+    if (m_count == m_items.size())
+      Reserve(m_count + 1);
+  }
+
+  std::vector<T> m_items;
+  size_t m_first = 0;
+  size_t m_count = 0;
+};
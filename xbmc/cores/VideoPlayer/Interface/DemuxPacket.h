@@ -11,6 +11,8 @@
 #include "TimingConstants.h"
 #include "addons/kodi-dev-kit/include/kodi/c-api/addon-instance/inputstream/demux_packet.h"
 
+#include <stddef.h>
+
 #define DMX_SPECIALID_STREAMINFO DEMUX_SPECIALID_STREAMINFO
 #define DMX_SPECIALID_STREAMCHANGE DEMUX_SPECIALID_STREAMCHANGE
 
@@ -19,6 +21,8 @@ extern "C"
 {
 #endif /* __cplusplus */
 
+  struct AVBufferRef;
+
   struct DemuxPacket : DEMUX_PACKET
   {
     DemuxPacket()
@@ -43,6 +47,12 @@ extern "C"
 
     //! @brief PTS offset correction applied to the PTS and DTS.
     double m_ptsOffsetCorrection{0};
+
+    //! @brief Allocated size of pData including padding, used to recycle the buffer.
+    size_t m_dataCapacity{0};
+
+    //! @brief Reference to the ffmpeg buffer owning pData if the payload was not copied.
+    AVBufferRef* m_avBuffer{nullptr};
   };
 
 #ifdef __cplusplus
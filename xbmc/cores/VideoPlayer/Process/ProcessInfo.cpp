@@ -670,6 +670,14 @@ void CProcessInfo::SetPlayTimes(time_t start, int64_t current, int64_t min, int6
   }
 }
 
+void CProcessInfo::SetDemuxPacketPoolStats(uint64_t hits, uint64_t misses, size_t cachedBytes)
+{
+  if (m_dataCache)
+  {
+    m_dataCache->SetDemuxPacketPoolStats(hits, misses, cachedBytes);
+  }
+}
+
 int64_t CProcessInfo::GetMaxTime()
 {
   std::unique_lock<CCriticalSection> lock(m_stateSection);
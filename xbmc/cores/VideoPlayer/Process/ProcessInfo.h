@@ -112,6 +112,7 @@ public:
   unsigned int GetMaxPassthroughOffSyncDuration() const;
 
   void SetPlayTimes(time_t start, int64_t current, int64_t min, int64_t max);
+  void SetDemuxPacketPoolStats(uint64_t hits, uint64_t misses, size_t cachedBytes);
   int64_t GetMaxTime();
 
   // settings
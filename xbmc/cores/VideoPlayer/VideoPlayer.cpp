@@ -15,6 +15,7 @@
 #include "DVDDemuxers/DVDDemuxUtils.h"
 #include "DVDDemuxers/DVDDemuxVobsub.h"
 #include "DVDDemuxers/DVDFactoryDemuxer.h"
+#include "DVDDemuxers/DemuxPacketPool.h"
 #include "DVDInputStreams/DVDFactoryInputStream.h"
 #include "DVDInputStreams/DVDInputStream.h"
 #include "network/NetworkFileItemClassify.h"
@@ -2588,6 +2589,9 @@ void CVideoPlayer::OnExit()
   // clean up all selection streams
   m_SelectionStreams.Clear(STREAM_NONE, STREAM_SOURCE_NONE);
 
+  // give the memory held for recycling demux packets back to the system
+  CDemuxPacketPool::GetInstance().Trim();
+
   m_messenger.End();
 
   CFFmpegLog::ClearLogLevel();
@@ -4995,6 +4999,10 @@ void CVideoPlayer::UpdatePlayState(double timeout)
 
   m_processInfo->SetPlayTimes(state.startTime, state.time, state.timeMin, state.timeMax);
 
+  const CDemuxPacketPool::Stats poolStats = CDemuxPacketPool::GetInstance().GetStats();
+  m_processInfo->SetDemuxPacketPoolStats(poolStats.hits, poolStats.misses,
+                                         poolStats.cachedBytes);
+
   std::unique_lock<CCriticalSection> lock(m_StateSection);
   m_State = state;
 }
@@ -0,0 +1,142 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DemuxPacketPool.h"
+#include "cores/VideoPlayer/Interface/DemuxPacket.h"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(TestDemuxPacketPool, RecycleData)
+{
+  CDemuxPacketPool pool(1024 * 1024);
+
+  size_t capacity = 0;
+  uint8_t* data = pool.AcquireData(1000, capacity);
+  ASSERT_NE(data, nullptr);
+  EXPECT_GE(capacity, 1000u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % 16, 0u);
+
+  pool.ReleaseData(data, capacity);
+  EXPECT_EQ(pool.GetStats().cachedBytes, capacity);
+
+  // a slightly smaller request maps to the same size class
+  size_t capacity2 = 0;
+  uint8_t* data2 = pool.AcquireData(900, capacity2);
+  EXPECT_EQ(data2, data);
+  EXPECT_EQ(capacity2, capacity);
+  pool.ReleaseData(data2, capacity2);
+
+  const CDemuxPacketPool::Stats stats = pool.GetStats();
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.misses, 1u);
+}
+
+TEST(TestDemuxPacketPool, SizeClassSlack)
+{
+  CDemuxPacketPool pool(0);
+
+  for (size_t size : {1u, 1025u, 3000u, 70000u, 1000000u, 5000000u})
+  {
+    size_t capacity = 0;
+    uint8_t* data = pool.AcquireData(size, capacity);
+    ASSERT_NE(data, nullptr);
+    EXPECT_GE(capacity, size);
+    if (size > 1024)
+      EXPECT_LE(capacity, size + size / 4);
+    pool.ReleaseData(data, capacity);
+  }
+
+  // zero budget, nothing is kept
+  EXPECT_EQ(pool.GetStats().cachedBytes, 0u);
+}
+
+TEST(TestDemuxPacketPool, Budget)
+{
+  CDemuxPacketPool pool(64 * 1024);
+
+  std::vector<std::pair<uint8_t*, size_t>> buffers;
+  for (int i = 0; i < 8; ++i)
+  {
+    size_t capacity = 0;
+    uint8_t* data = pool.AcquireData(16 * 1024, capacity);
+    buffers.emplace_back(data, capacity);
+  }
+  for (const auto& buffer : buffers)
+    pool.ReleaseData(buffer.first, buffer.second);
+
+  EXPECT_LE(pool.GetStats().cachedBytes, 64u * 1024);
+
+  // oversized buffers are never cached
+  size_t capacity = 0;
+  uint8_t* data = pool.AcquireData(32 * 1024 * 1024, capacity);
+  ASSERT_NE(data, nullptr);
+  pool.ReleaseData(data, capacity);
+  EXPECT_LE(pool.GetStats().cachedBytes, 64u * 1024);
+
+  pool.Trim();
+  EXPECT_EQ(pool.GetStats().cachedBytes, 0u);
+}
+
+TEST(TestDemuxPacketPool, RecyclePacket)
+{
+  CDemuxPacketPool pool(1024 * 1024);
+
+  DemuxPacket* packet = pool.AcquirePacket();
+  packet->iSize = 100;
+  packet->pts = 1.0;
+  packet->iStreamId = 3;
+  pool.ReleasePacket(packet);
+
+  DemuxPacket* packet2 = pool.AcquirePacket();
+  EXPECT_EQ(packet2, packet);
+  EXPECT_EQ(packet2->iSize, 0);
+  EXPECT_EQ(packet2->pts, DVD_NOPTS_VALUE);
+  EXPECT_EQ(packet2->iStreamId, -1);
+  pool.ReleasePacket(packet2);
+}
+
+TEST(TestDemuxPacketPool, Concurrent)
+{
+  constexpr int THREADS = 4;
+  constexpr int PACKETS = 10000;
+
+  CDemuxPacketPool pool(4 * 1024 * 1024);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < THREADS; ++t)
+  {
+    threads.emplace_back([&pool]() {
+      std::vector<std::pair<uint8_t*, size_t>> inFlight;
+      for (int i = 0; i < PACKETS; ++i)
+      {
+        size_t capacity = 0;
+        uint8_t* data = pool.AcquireData(4000 + (i % 7) * 500, capacity);
+        data[capacity - 1] = static_cast<uint8_t>(i);
+        inFlight.emplace_back(data, capacity);
+        if (inFlight.size() > 50)
+        {
+          for (const auto& buffer : inFlight)
+            pool.ReleaseData(buffer.first, buffer.second);
+          inFlight.clear();
+        }
+      }
+      for (const auto& buffer : inFlight)
+        pool.ReleaseData(buffer.first, buffer.second);
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  const CDemuxPacketPool::Stats stats = pool.GetStats();
+  EXPECT_EQ(stats.hits + stats.misses, static_cast<uint64_t>(THREADS * PACKETS));
+  EXPECT_GT(stats.hits, stats.misses);
+}
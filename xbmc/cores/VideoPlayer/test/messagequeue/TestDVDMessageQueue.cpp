@@ -0,0 +1,216 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "cores/VideoPlayer/DVDDemuxers/DVDDemuxUtils.h"
+#include "cores/VideoPlayer/DVDMessageQueue.h"
+#include "cores/VideoPlayer/DVDMessageRing.h"
+#include "cores/VideoPlayer/Interface/DemuxPacket.h"
+#include "cores/VideoPlayer/Interface/TimingConstants.h"
+
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+std::shared_ptr<CDVDMsg> CreatePacket(int size, double dts)
+{
+  DemuxPacket* packet = CDVDDemuxUtils::AllocateDemuxPacket(size);
+  packet->iSize = size;
+  packet->dts = dts;
+  packet->pts = dts;
+  return std::make_shared<CDVDMsgDemuxerPacket>(packet);
+}
+
+double GetDts(const std::shared_ptr<CDVDMsg>& msg)
+{
+  return std::static_pointer_cast<CDVDMsgDemuxerPacket>(msg)->GetPacket()->dts;
+}
+} // namespace
+
+TEST(TestDVDMessageRing, FrontBackOrder)
+{
+  CDVDMessageRing<int> ring(4);
+
+  ring.EmplaceFront(1);
+  ring.EmplaceFront(2);
+  ring.EmplaceBack(0);
+
+  ASSERT_EQ(ring.Size(), 3u);
+  EXPECT_EQ(ring.Front(), 2);
+  EXPECT_EQ(ring.Back(), 0);
+
+  ring.PopBack();
+  EXPECT_EQ(ring.Back(), 1);
+  ring.PopBack();
+  EXPECT_EQ(ring.Back(), 2);
+  ring.PopBack();
+  EXPECT_TRUE(ring.Empty());
+}
+
+TEST(TestDVDMessageRing, GrowKeepsOrder)
+{
+  CDVDMessageRing<int> ring(16);
+
+  // wrap the ring before it has to grow
+  for (int i = 0; i < 10; ++i)
+    ring.EmplaceFront(i);
+  for (int i = 0; i < 10; ++i)
+    ring.PopBack();
+
+  for (int i = 0; i < 100; ++i)
+    ring.EmplaceFront(i);
+
+  EXPECT_GE(ring.Capacity(), 100u);
+  for (int i = 0; i < 100; ++i)
+  {
+    EXPECT_EQ(ring.Back(), i);
+    ring.PopBack();
+  }
+}
+
+TEST(TestDVDMessageRing, InsertAndRemove)
+{
+  CDVDMessageRing<int> ring;
+
+  for (int i = 0; i < 8; ++i)
+    ring.EmplaceBack(i);
+
+  ring.Emplace(0, 100);
+  ring.Emplace(5, 200);
+  ring.Emplace(ring.Size(), 300);
+  ASSERT_EQ(ring.Size(), 11u);
+  EXPECT_EQ(ring.At(0), 100);
+  EXPECT_EQ(ring.At(5), 200);
+  EXPECT_EQ(ring.Back(), 300);
+
+  ring.RemoveIf([](int value) { return value >= 100 || value % 2; });
+  ASSERT_EQ(ring.Size(), 4u);
+  for (size_t i = 0; i < ring.Size(); ++i)
+    EXPECT_EQ(ring.At(i), static_cast<int>(i * 2));
+}
+
+TEST(TestDVDMessageQueue, PacketsAndPriority)
+{
+  CDVDMessageQueue queue("test");
+  queue.Init();
+
+  queue.Put(CreatePacket(100, DVD_MSEC_TO_TIME(0)));
+  queue.Put(CreatePacket(200, DVD_MSEC_TO_TIME(500)));
+  queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_RESYNC), 1);
+  queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_FLUSH), 2);
+
+  EXPECT_EQ(queue.GetDataSize(), 300);
+  EXPECT_EQ(queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET), 2u);
+  EXPECT_DOUBLE_EQ(queue.GetTimeSize(), 0.5);
+
+  std::shared_ptr<CDVDMsg> msg;
+  int priority = 0;
+  ASSERT_EQ(queue.Get(msg, 0ms, priority), MSGQ_OK);
+  EXPECT_TRUE(msg->IsType(CDVDMsg::GENERAL_FLUSH));
+  EXPECT_EQ(priority, 2);
+
+  priority = 0;
+  ASSERT_EQ(queue.Get(msg, 0ms, priority), MSGQ_OK);
+  EXPECT_TRUE(msg->IsType(CDVDMsg::GENERAL_RESYNC));
+
+  priority = 0;
+  ASSERT_EQ(queue.Get(msg, 0ms, priority), MSGQ_OK);
+  EXPECT_DOUBLE_EQ(GetDts(msg), DVD_MSEC_TO_TIME(0));
+  EXPECT_EQ(queue.GetDataSize(), 200);
+
+  // a packet put back is the next one to be returned
+  queue.PutBack(msg);
+  ASSERT_EQ(queue.Get(msg, 0ms), MSGQ_OK);
+  EXPECT_DOUBLE_EQ(GetDts(msg), DVD_MSEC_TO_TIME(0));
+
+  ASSERT_EQ(queue.Get(msg, 0ms), MSGQ_OK);
+  EXPECT_DOUBLE_EQ(GetDts(msg), DVD_MSEC_TO_TIME(500));
+  EXPECT_EQ(queue.GetDataSize(), 0);
+  EXPECT_EQ(queue.Get(msg, 0ms), MSGQ_TIMEOUT);
+
+  queue.End();
+}
+
+TEST(TestDVDMessageQueue, FlushByType)
+{
+  CDVDMessageQueue queue("test");
+  queue.Init();
+
+  for (int i = 0; i < 10; ++i)
+  {
+    queue.Put(CreatePacket(10, DVD_MSEC_TO_TIME(i * 40)));
+    queue.Put(std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_PAUSE));
+  }
+
+  queue.Flush();
+  EXPECT_EQ(queue.GetDataSize(), 0);
+  EXPECT_EQ(queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET), 0u);
+  EXPECT_EQ(queue.GetPacketCount(CDVDMsg::GENERAL_PAUSE), 10u);
+
+  queue.End();
+}
+
+TEST(TestDVDMessageQueue, ProducerConsumer)
+{
+  constexpr int PACKETS = 100000;
+
+  CDVDMessageQueue queue("test");
+  queue.Init();
+
+  std::thread producer([&queue]() {
+    for (int i = 0; i < PACKETS; ++i)
+    {
+      while (queue.GetPacketCount(CDVDMsg::DEMUXER_PACKET) > 1000)
+        std::this_thread::yield();
+      queue.Put(CreatePacket(1, i));
+    }
+  });
+
+  int received = 0;
+  bool ordered = true;
+  std::shared_ptr<CDVDMsg> msg;
+  while (received < PACKETS && queue.Get(msg, 1000ms) == MSGQ_OK)
+  {
+    ordered &= GetDts(msg) == received;
+    received++;
+  }
+
+  producer.join();
+
+  EXPECT_EQ(received, PACKETS);
+  EXPECT_TRUE(ordered);
+
+  queue.End();
+}
+
+TEST(TestDVDMessageRing, RefillReleasesMessages)
+{
+  constexpr int ITERATIONS = 100;
+  constexpr int DEPTH = 500;
+
+  const auto msg = std::make_shared<CDVDMsg>(CDVDMsg::GENERAL_RESYNC);
+
+  // the slots are reused on each round and must not keep the messages alive
+  CDVDMessageRing<DVDMessageListItem> ring(DEPTH);
+  for (int i = 0; i < ITERATIONS; ++i)
+  {
+    for (int j = 0; j < DEPTH; ++j)
+      ring.EmplaceFront(msg, 0);
+    EXPECT_EQ(msg.use_count(), DEPTH + 1);
+    while (!ring.Empty())
+      ring.PopBack();
+  }
+
+  EXPECT_TRUE(ring.Empty());
+  EXPECT_EQ(msg.use_count(), 1);
+}
@@ -80,6 +80,64 @@ std::string Database::prepare(const char* format, ...)
   return result;
 }
 
+std::string Database::bind_params(const std::string& sql, const ParamValues& params)
+{
+  std::string result;
+  result.reserve(sql.size() + params.size() * 16);
+
+  size_t param = 0;
+  char quote = 0;
+  for (const char c : sql)
+  {
+    if (quote)
+    {
+      if (c == quote)
+        quote = 0;
+    }
+    else if (c == '\'' || c == '"')
+      quote = c;
+    else if (c == '?')
+    {
+      if (param >= params.size())
+        throw DbErrors("Not enough parameters for statement: %s", sql.c_str());
+
+      const field_value& value = params[param++];
+      if (value.get_isNull())
+        result += "NULL";
+      else
+      {
+        switch (value.get_fType())
+        {
+          case ft_Boolean:
+            result += value.get_asBool() ? "1" : "0";
+            break;
+          case ft_Float:
+          case ft_Double:
+            result += StringUtils::Format("{}", value.get_asDouble());
+            break;
+          case ft_Short:
+          case ft_UShort:
+          case ft_Int:
+          case ft_UInt:
+          case ft_Int64:
+            result += std::to_string(value.get_asInt64());
+            break;
+          default:
+            result += prepare("'%s'", value.get_asString().c_str());
+            break;
+        }
+      }
+      continue;
+    }
+    result += c;
+  }
+
+  if (param != params.size())
+    throw DbErrors("Too many parameters for statement: %s", sql.c_str());
+
+  return result;
+}
+
 //************* Dataset implementation ***************
 
 Dataset::Dataset() : select_sql("")
@@ -203,6 +261,16 @@ void Dataset::parse_sql(std::string& sql)
   } //for
 }
 
+int Dataset::exec(const std::string& sql, const ParamValues& params)
+{
+  return exec(db->bind_params(sql, params));
+}
+
+bool Dataset::query(const std::string& sql, const ParamValues& params)
+{
+  return query(db->bind_params(sql, params));
+}
+
 void Dataset::close(void)
 {
   haveError = false;
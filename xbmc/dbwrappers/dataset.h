@@ -163,6 +163,14 @@ public:
    */
   virtual std::string vprepare(const char* format, va_list args) = 0;
 
+  /*! \brief Substitute the ? placeholders of a statement with escaped literals.
+   Used by datasets without native parameter binding.
+   \param sql - statement with ? placeholders outside of quoted strings.
+   \param params - values for the placeholders, in order.
+   \return the statement with the values inlined.
+   */
+  std::string bind_params(const std::string& sql, const ParamValues& params);
+
   virtual bool in_transaction() { return false; }
 };
 
@@ -314,6 +322,10 @@ public:
   virtual const void* getExecRes() = 0;
   /* as open, but with our query exec Sql */
   virtual bool query(const std::string& sql) = 0;
+  /* as exec and query, with params bound to the ? placeholders of sql. Datasets that
+   support it keep the parsed statement around, so sql should be the same text each time */
+  virtual int exec(const std::string& sql, const ParamValues& params);
+  virtual bool query(const std::string& sql, const ParamValues& params);
   /* Close SQL Query*/
   virtual void close();
   /* This function looks for field Field_name with value equal Field_value
@@ -1766,17 +1766,13 @@ void MysqlDataset::fill_fields()
   }
 
   //Filling result
-  if (result.records.size() != 0)
+  if (frecno >= 0 && static_cast<size_t>(frecno) < result.records.size())
   {
-    const sql_record* row = result.records[frecno];
-    if (row)
-    {
-      const unsigned int ncols = row->size();
-      fields_object->resize(ncols);
-      for (unsigned int i = 0; i < ncols; i++)
-        (*fields_object)[i].val = row->at(i);
-      return;
-    }
+    const unsigned int ncols = result.records.num_columns();
+    fields_object->resize(ncols);
+    for (unsigned int i = 0; i < ncols; i++)
+      result.records.get_value(frecno, i, (*fields_object)[i].val);
+    return;
   }
   const unsigned int ncols = result.record_header.size();
   fields_object->resize(ncols);
@@ -1925,23 +1921,24 @@ bool MysqlDataset::query(const std::string& query)
     result.record_header[i].name = fields[i].name;
 
   // returned rows
+  query_data& rows = result.records;
+  rows.reset(numColumns);
   while ((row = mysql_fetch_row(stmt)))
   { // have a row of data
-    sql_record* res = new sql_record;
-    res->resize(numColumns);
+    const unsigned long* lengths = mysql_fetch_lengths(stmt);
+    const size_t index = rows.add_row();
     for (unsigned int i = 0; i < numColumns; i++)
     {
-      field_value& v = res->at(i);
       switch (fields[i].type)
       {
         case MYSQL_TYPE_LONGLONG:
           if (row[i] != nullptr)
           {
-            v.set_asInt64(strtoll(row[i], nullptr, 10));
+            rows.set_int64(index, i, strtoll(row[i], nullptr, 10));
           }
           else
           {
-            v.set_asInt64(0);
+            rows.set_int64(index, i, 0);
           }
           break;
         case MYSQL_TYPE_DECIMAL:
@@ -1952,46 +1949,42 @@ bool MysqlDataset::query(const std::string& query)
         case MYSQL_TYPE_LONG:
           if (row[i] != NULL)
           {
-            v.set_asInt(atoi(row[i]));
+            rows.set_int(index, i, atoi(row[i]));
           }
           else
           {
-            v.set_asInt(0);
+            rows.set_int(index, i, 0);
           }
           break;
         case MYSQL_TYPE_FLOAT:
         case MYSQL_TYPE_DOUBLE:
           if (row[i] != NULL)
           {
-            v.set_asDouble(atof(row[i]));
+            rows.set_double(index, i, atof(row[i]));
           }
           else
           {
-            v.set_asDouble(0);
+            rows.set_double(index, i, 0);
           }
           break;
         case MYSQL_TYPE_STRING:
         case MYSQL_TYPE_VAR_STRING:
         case MYSQL_TYPE_VARCHAR:
-          if (row[i] != NULL)
-            v.set_asString((const char*)row[i]);
-          break;
         case MYSQL_TYPE_TINY_BLOB:
         case MYSQL_TYPE_MEDIUM_BLOB:
         case MYSQL_TYPE_LONG_BLOB:
         case MYSQL_TYPE_BLOB:
           if (row[i] != NULL)
-            v.set_asString((const char*)row[i]);
+            rows.set_string(index, i, row[i], lengths[i]);
+          else
+            rows.set_string(index, i, "", 0);
           break;
         case MYSQL_TYPE_NULL:
         default:
           CLog::Log(LOGDEBUG, "MYSQL: Unknown field type: {}", fields[i].type);
-          v.set_asString("");
-          v.set_isNull();
           break;
       }
     }
-    result.records.push_back(res);
   }
   mysql_free_result(stmt);
   active = true;
@@ -2079,19 +2072,6 @@ void MysqlDataset::next(void)
     fill_fields();
 }
 
-void MysqlDataset::free_row(void)
-{
-  if (frecno < 0 || (unsigned int)frecno >= result.records.size())
-    return;
-
-  sql_record* row = result.records[frecno];
-  if (row)
-  {
-    delete row;
-    result.records[frecno] = NULL;
-  }
-}
-
 bool MysqlDataset::seek(int pos)
 {
   if (ds_state == dsSelect)
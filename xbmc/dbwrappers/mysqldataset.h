@@ -116,8 +116,6 @@ protected:
   /* This function works only with MySQL database
   Filling the fields information from select statement */
   void fill_fields() override;
-  /* Changing field values during dataset navigation */
-  virtual void free_row(); // free the memory allocated for the current row
 
 public:
   /* constructor */
@@ -137,9 +135,12 @@ or insert() operations default = false) */
   /* func. executes a query without results to return */
   int exec() override;
   int exec(const std::string& sql) override;
+  // parameters are inlined as escaped literals, the server parses each statement
+  using Dataset::exec;
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  using Dataset::query;
   /* func. closes a query */
   void close(void) override;
   /* Cancel changes, made in insert or edit states of dataset */
@@ -19,7 +19,9 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <stdexcept>
 #include <stdlib.h>
+#include <utility>
 
 #ifndef __GNUC__
 #pragma warning(disable : 4800)
@@ -42,6 +44,18 @@ field_value::field_value(const char* s) : str_value(s)
   is_null = false;
 }
 
+field_value::field_value(const std::string& s) : str_value(s)
+{
+  field_type = ft_String;
+  is_null = false;
+}
+
+field_value::field_value(std::string&& s) : str_value(std::move(s))
+{
+  field_type = ft_String;
+  is_null = false;
+}
+
 field_value::field_value(const bool b)
 {
   bool_value = b;
@@ -947,4 +961,156 @@ std::string field_value::gft()
   return tmp;
 }
 
+result_table::result_table()
+{
+  m_cachedRows.fill(SIZE_MAX);
+}
+
+void result_table::reset(unsigned int columns)
+{
+  // keep the capacity around, datasets are reused for many queries
+  m_columns.resize(columns);
+  for (auto& column : m_columns)
+    column.clear();
+  m_arena.clear();
+  m_rows = 0;
+  m_cachedRows.fill(SIZE_MAX);
+}
+
+size_t result_table::add_row()
+{
+  cell empty;
+  empty.offset = 0;
+  empty.length = 0;
+  empty.type = ft_String;
+  empty.null = true;
+  for (auto& column : m_columns)
+    column.push_back(empty);
+  return m_rows++;
+}
+
+void result_table::set_int(size_t row, unsigned int col, int value)
+{
+  cell& c = cell_at(row, col);
+  c.int_value = value;
+  c.type = ft_Int;
+  c.null = false;
+}
+
+void result_table::set_int64(size_t row, unsigned int col, int64_t value)
+{
+  cell& c = cell_at(row, col);
+  c.int_value = value;
+  c.type = ft_Int64;
+  c.null = false;
+}
+
+void result_table::set_double(size_t row, unsigned int col, double value)
+{
+  cell& c = cell_at(row, col);
+  c.double_value = value;
+  c.type = ft_Double;
+  c.null = false;
+}
+
+void result_table::set_string(size_t row, unsigned int col, const char* value, size_t len)
+{
+  cell& c = cell_at(row, col);
+  c.offset = m_arena.size();
+  c.length = static_cast<uint32_t>(len);
+  c.type = ft_String;
+  c.null = false;
+  // terminated so that the numeric getters can parse the text in place
+  m_arena.insert(m_arena.end(), value, value + len);
+  m_arena.push_back('\0');
+}
+
+int64_t result_table::get_int64(size_t row, unsigned int col) const
+{
+  const cell& c = cell_at(row, col);
+  if (c.null)
+    return 0; // a NULL has no text in the arena
+  switch (c.type)
+  {
+    case ft_String:
+      return std::atoll(m_arena.data() + c.offset);
+    case ft_Double:
+      return static_cast<int64_t>(c.double_value);
+    default:
+      return c.int_value;
+  }
+}
+
+double result_table::get_double(size_t row, unsigned int col) const
+{
+  const cell& c = cell_at(row, col);
+  if (c.null)
+    return 0.0;
+  switch (c.type)
+  {
+    case ft_String:
+      return atof(m_arena.data() + c.offset);
+    case ft_Double:
+      return c.double_value;
+    default:
+      return static_cast<double>(c.int_value);
+  }
+}
+
+std::string_view result_table::get_string(size_t row, unsigned int col) const
+{
+  const cell& c = cell_at(row, col);
+  if (c.type != ft_String || c.length == 0)
+    return {};
+  return std::string_view(m_arena.data() + c.offset, c.length);
+}
+
+void result_table::get_value(size_t row, unsigned int col, field_value& value) const
+{
+  const cell& c = cell_at(row, col);
+  value.field_type = c.type;
+  value.is_null = c.null;
+  switch (c.type)
+  {
+    case ft_String:
+      value.str_value.assign(m_arena.data() + c.offset, c.length);
+      break;
+    case ft_Int:
+      value.int_value = static_cast<int>(c.int_value);
+      break;
+    case ft_Double:
+      value.double_value = c.double_value;
+      break;
+    default:
+      value.int64_value = c.int_value;
+      break;
+  }
+}
+
+sql_record* result_table::at(size_t row) const
+{
+  if (row >= m_rows)
+    throw std::out_of_range("result_table::at");
+  return materialize(row);
+}
+
+sql_record* result_table::materialize(size_t row) const
+{
+  for (unsigned int i = 0; i < ROW_CACHE_SIZE; i++)
+  {
+    if (m_cachedRows[i] == row)
+      return &m_rowCache[i];
+  }
+
+  const unsigned int slot = m_nextCacheSlot;
+  m_nextCacheSlot = (m_nextCacheSlot + 1) % ROW_CACHE_SIZE;
+
+  sql_record& record = m_rowCache[slot];
+  record.resize(m_columns.size());
+  for (unsigned int col = 0; col < m_columns.size(); col++)
+    get_value(row, col, record[col]);
+  m_cachedRows[slot] = row;
+  return &record;
+}
+
 } // namespace dbiplus
@@ -12,9 +12,11 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <stdint.h>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace dbiplus
@@ -64,9 +66,13 @@ private:
 
   bool is_null;
 
+  friend class result_table;
+
 public:
   field_value();
   explicit field_value(const char* s);
+  explicit field_value(const std::string& s);
+  explicit field_value(std::string&& s);
   explicit field_value(const bool b);
   explicit field_value(const char c);
   explicit field_value(const short s);
@@ -249,19 +255,90 @@ struct field
 typedef std::vector<field> Fields;
 typedef std::vector<field_value> sql_record;
 typedef std::vector<field_prop> record_prop;
-typedef std::vector<sql_record*> query_data;
+typedef std::vector<field_value> ParamValues; // values for the ? placeholders of a statement
 typedef field_value variant;
 
+/*!
+ * \brief Column oriented storage for the rows of a query result
+ *
+ * Each column keeps its cells in one typed array and the text of all string cells is packed
+ * into a single character arena, so reading a result needs a handful of allocations instead
+ * of a std::string per cell.
+ *
+ * at() and operator[] keep the old row based access working: the requested row is copied
+ * into one of ROW_CACHE_SIZE recycled records. The returned pointer stays valid until as
+ * many other rows have been requested or the table is cleared.
+ */
+class result_table
+{
+public:
+  static constexpr unsigned int ROW_CACHE_SIZE = 4;
+
+  result_table();
+
+  /*! \brief Drop all rows and start a result with the given number of columns */
+  void reset(unsigned int columns);
+  void clear() { reset(0); }
+
+  unsigned int num_columns() const { return static_cast<unsigned int>(m_columns.size()); }
+  size_t size() const { return m_rows; }
+  bool empty() const { return m_rows == 0; }
+
+  /*! \brief Append a row with all cells NULL and return its index */
+  size_t add_row();
+  void set_int(size_t row, unsigned int col, int value);
+  void set_int64(size_t row, unsigned int col, int64_t value);
+  void set_double(size_t row, unsigned int col, double value);
+  void set_string(size_t row, unsigned int col, const char* value, size_t len);
+
+  fType get_type(size_t row, unsigned int col) const { return cell_at(row, col).type; }
+  bool is_null(size_t row, unsigned int col) const { return cell_at(row, col).null; }
+  int64_t get_int64(size_t row, unsigned int col) const;
+  double get_double(size_t row, unsigned int col) const;
+  /*! \brief Text of a string cell, empty for numeric cells. Valid until the table changes. */
+  std::string_view get_string(size_t row, unsigned int col) const;
+
+  /*! \brief Copy a cell into value, reusing the memory value already owns */
+  void get_value(size_t row, unsigned int col, field_value& value) const;
+
+  /*! \brief Materialize a row, at() throws std::out_of_range for a bad index */
+  sql_record* at(size_t row) const;
+  sql_record* operator[](size_t row) const { return materialize(row); }
+
+private:
+  struct cell
+  {
+    union
+    {
+      int64_t int_value;
+      double double_value;
+      size_t offset; // of the text in the arena
+    };
+    uint32_t length;
+    fType type;
+    bool null;
+  };
+
+  cell& cell_at(size_t row, unsigned int col) { return m_columns[col][row]; }
+  const cell& cell_at(size_t row, unsigned int col) const { return m_columns[col][row]; }
+  sql_record* materialize(size_t row) const;
+
+  std::vector<std::vector<cell>> m_columns;
+  std::vector<char> m_arena;
+  size_t m_rows = 0;
+
+  mutable std::array<sql_record, ROW_CACHE_SIZE> m_rowCache;
+  mutable std::array<size_t, ROW_CACHE_SIZE> m_cachedRows;
+  mutable unsigned int m_nextCacheSlot = 0;
+};
+
+typedef result_table query_data;
+
 class result_set
 {
 public:
-  result_set() = default;
-  ~result_set() { clear(); };
   void clear()
   {
-    for (unsigned int i = 0; i < records.size(); i++)
-      if (records[i])
-        delete records[i];
     records.clear();
     record_header.clear();
   };
@@ -17,6 +17,7 @@
 #include "utils/XTimeUtils.h"
 #include "utils/log.h"
 
+#include <cstring>
 #include <iostream>
 #include <map>
 #include <sstream>
@@ -26,6 +27,53 @@ using namespace std::chrono_literals;
 
 namespace
 {
+constexpr size_t STATEMENT_CACHE_SIZE = 64;
+
+void BindParams(sqlite3_stmt* stmt, const dbiplus::ParamValues& params)
+{
+  if (sqlite3_bind_parameter_count(stmt) != static_cast<int>(params.size()))
+    throw dbiplus::DbErrors("Parameter count mismatch for statement: %s", sqlite3_sql(stmt));
+
+  for (size_t i = 0; i < params.size(); i++)
+  {
+    const dbiplus::field_value& value = params[i];
+    const int index = static_cast<int>(i) + 1;
+    int res;
+    if (value.get_isNull())
+    {
+      res = sqlite3_bind_null(stmt, index);
+    }
+    else
+    {
+      switch (value.get_fType())
+      {
+        case dbiplus::ft_Boolean:
+        case dbiplus::ft_Short:
+        case dbiplus::ft_UShort:
+        case dbiplus::ft_Int:
+        case dbiplus::ft_UInt:
+        case dbiplus::ft_Int64:
+          res = sqlite3_bind_int64(stmt, index, value.get_asInt64());
+          break;
+        case dbiplus::ft_Float:
+        case dbiplus::ft_Double:
+          res = sqlite3_bind_double(stmt, index, value.get_asDouble());
+          break;
+        default:
+        {
+          const std::string str = value.get_asString();
+          res = sqlite3_bind_text(stmt, index, str.c_str(), static_cast<int>(str.size()),
+                                  SQLITE_TRANSIENT);
+          break;
+        }
+      }
+    }
+    if (res != SQLITE_OK)
+      throw dbiplus::DbErrors("Unable to bind parameter %d of statement: %s", index,
+                              sqlite3_sql(stmt));
+  }
+}
+
 #define X(VAL) std::make_pair(VAL, #VAL)
 //!@todo Remove ifdefs when sqlite version requirement has been bumped to at least 3.26.0
 const std::map<int, const char*> g_SqliteErrorStrings = {
@@ -176,26 +224,17 @@ int callback(void* res_ptr, int ncol, char** result, char** cols)
       header.name = cols[i];
       r->record_header.push_back(header);
     }
+    r->records.reset(ncol);
   }
 
   if (result != NULL)
   {
-    sql_record* rec = new sql_record;
-    rec->resize(ncol);
+    const size_t row = r->records.add_row();
     for (int i = 0; i < ncol; i++)
     {
-      field_value& v = rec->at(i);
-      if (result[i] == NULL)
-      {
-        v.set_asString("");
-        v.set_isNull();
-      }
-      else
-      {
-        v.set_asString(result[i]);
-      }
+      if (result[i] != NULL)
+        r->records.set_string(row, i, result[i], strlen(result[i]));
     }
-    r->records.push_back(rec);
   }
   return 0;
 }
@@ -383,6 +422,7 @@ void SqliteDatabase::disconnect(void)
 {
   if (active == false)
     return;
+  clearStatements();
   sqlite3_close(conn);
   active = false;
 }
@@ -678,6 +718,55 @@ std::string SqliteDatabase::vprepare(const char* format, va_list args)
   return strResult;
 }
 
+sqlite3_stmt* SqliteDatabase::acquireStatement(const std::string& sql)
+{
+  auto it = stmt_index.find(sql);
+  if (it != stmt_index.end())
+  {
+    sqlite3_stmt* stmt = it->second->stmt;
+    stmt_cache.erase(it->second);
+    stmt_index.erase(it);
+    return stmt;
+  }
+
+  sqlite3_stmt* stmt = nullptr;
+  if (setErr(sqlite3_prepare_v2(conn, sql.c_str(), -1, &stmt, nullptr), sql.c_str()) != SQLITE_OK)
+    throw DbErrors("%s", getErrorMsg());
+  return stmt;
+}
+
+int SqliteDatabase::releaseStatement(const std::string& sql, sqlite3_stmt* stmt)
+{
+  const int res = sqlite3_reset(stmt);
+  sqlite3_clear_bindings(stmt);
+
+  // the same statement may have been acquired twice by nested queries
+  if (stmt_index.find(sql) != stmt_index.end())
+  {
+    sqlite3_finalize(stmt);
+    return res;
+  }
+
+  stmt_cache.push_front({sql, stmt});
+  stmt_index[sql] = stmt_cache.begin();
+
+  if (stmt_cache.size() > STATEMENT_CACHE_SIZE)
+  {
+    stmt_index.erase(stmt_cache.back().sql);
+    sqlite3_finalize(stmt_cache.back().stmt);
+    stmt_cache.pop_back();
+  }
+  return res;
+}
+
+void SqliteDatabase::clearStatements()
+{
+  for (const auto& entry : stmt_cache)
+    sqlite3_finalize(entry.stmt);
+  stmt_cache.clear();
+  stmt_index.clear();
+}
+
 //************* SqliteDataset implementation ***************
 
 SqliteDataset::SqliteDataset() : Dataset()
@@ -800,17 +889,13 @@ void SqliteDataset::fill_fields()
   }
 
   //Filling result
-  if (result.records.size() != 0)
+  if (frecno >= 0 && static_cast<size_t>(frecno) < result.records.size())
   {
-    const sql_record* row = result.records[frecno];
-    if (row)
-    {
-      const unsigned int ncols = row->size();
-      fields_object->resize(ncols);
-      for (unsigned int i = 0; i < ncols; i++)
-        (*fields_object)[i].val = row->at(i);
-      return;
-    }
+    const unsigned int ncols = result.records.num_columns();
+    fields_object->resize(ncols);
+    for (unsigned int i = 0; i < ncols; i++)
+      result.records.get_value(frecno, i, (*fields_object)[i].val);
+    return;
   }
   const unsigned int ncols = result.record_header.size();
   fields_object->resize(ncols);
@@ -904,6 +989,41 @@ int SqliteDataset::exec(const std::string& sql)
   }
 }
 
+int SqliteDataset::exec(const std::string& sql, const ParamValues& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+
+  exec_res.clear();
+
+  const auto start = std::chrono::steady_clock::now();
+
+  SqliteDatabase* sqliteDb = static_cast<SqliteDatabase*>(db);
+  sqlite3_stmt* stmt = sqliteDb->acquireStatement(sql);
+  try
+  {
+    BindParams(stmt, params);
+  }
+  catch (...)
+  {
+    sqliteDb->releaseStatement(sql, stmt);
+    throw;
+  }
+
+  while (sqlite3_step(stmt) == SQLITE_ROW)
+    ;
+  const int res = db->setErr(sqliteDb->releaseStatement(sql, stmt), sql.c_str());
+
+  const auto end = std::chrono::steady_clock::now();
+  const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start);
+
+  CLog::LogFC(LOGDEBUG, LOGDATABASE, "{} ms for query: {}", duration.count(), sql);
+
+  if (res != SQLITE_OK)
+    throw DbErrors("%s", db->getErrorMsg());
+  return res;
+}
+
 int SqliteDataset::exec()
 {
   return exec(sql);
@@ -914,23 +1034,8 @@ const void* SqliteDataset::getExecRes()
   return &exec_res;
 }
 
-bool SqliteDataset::query(const std::string& query)
+void SqliteDataset::fetch_rows(sqlite3_stmt* stmt)
 {
-  if (!handle())
-    throw DbErrors("No Database Connection");
-  const std::string& qry = query;
-  int fs = qry.find("select");
-  int fS = qry.find("SELECT");
-  if (!(fs >= 0 || fS >= 0))
-    throw DbErrors("MUST be select SQL!");
-
-  close();
-
-  sqlite3_stmt* stmt = NULL;
-  if (db->setErr(sqlite3_prepare_v2(handle(), query.c_str(), -1, &stmt, NULL), query.c_str()) !=
-      SQLITE_OK)
-    throw DbErrors("%s", db->getErrorMsg());
-
   // column headers
   const unsigned int numColumns = sqlite3_column_count(stmt);
   result.record_header.resize(numColumns);
@@ -938,38 +1043,53 @@ bool SqliteDataset::query(const std::string& query)
     result.record_header[i].name = sqlite3_column_name(stmt, i);
 
   // returned rows
+  query_data& rows = result.records;
+  rows.reset(numColumns);
   while (sqlite3_step(stmt) == SQLITE_ROW)
   { // have a row of data
-    sql_record* res = new sql_record;
-    res->resize(numColumns);
+    const size_t row = rows.add_row();
     for (unsigned int i = 0; i < numColumns; i++)
     {
-      field_value& v = res->at(i);
       switch (sqlite3_column_type(stmt, i))
       {
         case SQLITE_INTEGER:
-          v.set_asInt64(sqlite3_column_int64(stmt, i));
+          rows.set_int64(row, i, sqlite3_column_int64(stmt, i));
           break;
         case SQLITE_FLOAT:
-          v.set_asDouble(sqlite3_column_double(stmt, i));
+          rows.set_double(row, i, sqlite3_column_double(stmt, i));
           break;
         case SQLITE_TEXT:
-          v.set_asString(reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
-                         sqlite3_column_bytes(stmt, i));
-          break;
         case SQLITE_BLOB:
-          v.set_asString(reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
-                         sqlite3_column_bytes(stmt, i));
+          rows.set_string(row, i, reinterpret_cast<const char*>(sqlite3_column_text(stmt, i)),
+                          sqlite3_column_bytes(stmt, i));
           break;
         case SQLITE_NULL:
         default:
-          v.set_asString("");
-          v.set_isNull();
           break;
       }
     }
-    result.records.push_back(res);
   }
+}
+
+bool SqliteDataset::query(const std::string& query)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+  const std::string& qry = query;
+  int fs = qry.find("select");
+  int fS = qry.find("SELECT");
+  if (!(fs >= 0 || fS >= 0))
+    throw DbErrors("MUST be select SQL!");
+
+  close();
+
+  sqlite3_stmt* stmt = NULL;
+  if (db->setErr(sqlite3_prepare_v2(handle(), query.c_str(), -1, &stmt, NULL), query.c_str()) !=
+      SQLITE_OK)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  fetch_rows(stmt);
+
   if (db->setErr(sqlite3_finalize(stmt), query.c_str()) == SQLITE_OK)
   {
     active = true;
@@ -983,6 +1103,37 @@ bool SqliteDataset::query(const std::string& query)
   }
 }
 
+bool SqliteDataset::query(const std::string& query, const ParamValues& params)
+{
+  if (!handle())
+    throw DbErrors("No Database Connection");
+  if (query.find("select") == std::string::npos && query.find("SELECT") == std::string::npos)
+    throw DbErrors("MUST be select SQL!");
+
+  close();
+
+  SqliteDatabase* sqliteDb = static_cast<SqliteDatabase*>(db);
+  sqlite3_stmt* stmt = sqliteDb->acquireStatement(query);
+  try
+  {
+    BindParams(stmt, params);
+    fetch_rows(stmt);
+  }
+  catch (...)
+  {
+    sqliteDb->releaseStatement(query, stmt);
+    throw;
+  }
+
+  if (db->setErr(sqliteDb->releaseStatement(query, stmt), query.c_str()) != SQLITE_OK)
+    throw DbErrors("%s", db->getErrorMsg());
+
+  active = true;
+  ds_state = dsSelect;
+  this->first();
+  return true;
+}
+
 void SqliteDataset::open(const std::string& sql)
 {
   set_select_sql(sql);
@@ -1062,19 +1213,6 @@ void SqliteDataset::next(void)
     fill_fields();
 }
 
-void SqliteDataset::free_row(void)
-{
-  if (frecno < 0 || (unsigned int)frecno >= result.records.size())
-    return;
-
-  sql_record* row = result.records[frecno];
-  if (row)
-  {
-    delete row;
-    result.records[frecno] = NULL;
-  }
-}
-
 bool SqliteDataset::seek(int pos)
 {
   if (ds_state == dsSelect)
@@ -14,7 +14,10 @@
 
 #include "dataset.h"
 
+#include <list>
 #include <stdio.h>
+#include <string>
+#include <unordered_map>
 
 #include <sqlite3.h>
 
@@ -84,6 +87,22 @@ public:
   std::string vprepare(const char* format, va_list args) override;
 
   bool in_transaction() override { return _in_transaction; }
+
+  /* prepared statement cache, used for statements with bound parameters.
+     A statement is owned by the caller between acquire and release, release resets it
+     and returns the result of the last step */
+  sqlite3_stmt* acquireStatement(const std::string& sql);
+  int releaseStatement(const std::string& sql, sqlite3_stmt* stmt);
+  void clearStatements();
+
+private:
+  struct CachedStatement
+  {
+    std::string sql;
+    sqlite3_stmt* stmt;
+  };
+  std::list<CachedStatement> stmt_cache; // most recently used first
+  std::unordered_map<std::string, std::list<CachedStatement>::iterator> stmt_index;
 };
 
 /***************** Class SqliteDataset definition *******************
@@ -111,8 +130,8 @@ protected:
   /* This function works only with MySQL database
   Filling the fields information from select statement */
   void fill_fields() override;
-  /* Changing field values during dataset navigation */
-  virtual void free_row(); // free the memory allocated for the current row
+  /* Reads all rows of a prepared statement into the result set */
+  void fetch_rows(sqlite3_stmt* stmt);
 
 public:
   /* constructor */
@@ -132,9 +151,11 @@ or insert() operations default = false) */
   /* func. executes a query without results to return */
   int exec() override;
   int exec(const std::string& sql) override;
+  int exec(const std::string& sql, const ParamValues& params) override;
   const void* getExecRes() override;
   /* as open, but with our query exec Sql */
   bool query(const std::string& query) override;
+  bool query(const std::string& query, const ParamValues& params) override;
   /* func. closes a query */
   void close(void) override;
   /* Cancel changes, made in insert or edit states of dataset */
@@ -0,0 +1,192 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "dbwrappers/sqlitedataset.h"
+#include "filesystem/SpecialProtocol.h"
+
+#include <stdexcept>
+#include <cstdio>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+using namespace dbiplus;
+
+class TestSqliteDataset : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_db.setHostName(CSpecialProtocol::TranslatePath("special://temp/").c_str());
+    m_db.setDatabase("TestSqliteDataset.db");
+    ASSERT_EQ(m_db.connect(true), DB_CONNECTION_OK);
+    m_ds.reset(m_db.CreateDataset());
+    m_ds->exec("DROP TABLE IF EXISTS path");
+    m_ds->exec("CREATE TABLE path (idPath INTEGER PRIMARY KEY, strPath TEXT, dateAdded TEXT, "
+               "playCount INTEGER, rating REAL)");
+    m_ds->exec("CREATE INDEX ix_path ON path (strPath)");
+  }
+
+  void TearDown() override
+  {
+    m_ds.reset();
+    m_db.disconnect();
+    std::remove(
+        CSpecialProtocol::TranslatePath("special://temp/TestSqliteDataset.db").c_str());
+  }
+
+  SqliteDatabase m_db;
+  std::unique_ptr<Dataset> m_ds;
+};
+
+TEST_F(TestSqliteDataset, BoundParameters)
+{
+  const std::string insert =
+      "INSERT INTO path (strPath, dateAdded, playCount, rating) VALUES (?, ?, ?, ?)";
+  m_ds->exec(insert, {field_value("/movies/it's a test/"), field_value(), field_value(3),
+                      field_value(7.5)});
+  ParamValues params{field_value("/music/"), field_value("2026-01-01"),
+                     field_value(static_cast<int64_t>(1) << 40), field_value(0.25)};
+  params[1].set_isNull();
+  m_ds->exec(insert, params);
+
+  ASSERT_TRUE(m_ds->query("SELECT * FROM path WHERE strPath = ?",
+                          {field_value("/movies/it's a test/")}));
+  ASSERT_EQ(m_ds->num_rows(), 1);
+  EXPECT_EQ(m_ds->fv("playCount").get_asInt(), 3);
+  EXPECT_DOUBLE_EQ(m_ds->fv("rating").get_asDouble(), 7.5);
+  EXPECT_EQ(m_ds->fv("dateAdded").get_asString(), "");
+  m_ds->close();
+
+  ASSERT_TRUE(m_ds->query("SELECT * FROM path WHERE strPath = ?", {field_value("/music/")}));
+  ASSERT_EQ(m_ds->num_rows(), 1);
+  EXPECT_TRUE(m_ds->fv("dateAdded").get_isNull());
+  EXPECT_EQ(m_ds->fv("playCount").get_asInt64(), static_cast<int64_t>(1) << 40);
+  m_ds->close();
+
+  // a ? inside a string literal is not a placeholder
+  ASSERT_TRUE(m_ds->query("SELECT '?' AS q, idPath FROM path WHERE playCount > ?",
+                          {field_value(2)}));
+  EXPECT_EQ(m_ds->num_rows(), 2);
+  EXPECT_EQ(m_ds->fv("q").get_asString(), "?");
+  m_ds->close();
+
+  EXPECT_THROW(m_ds->query("SELECT * FROM path WHERE strPath = ?", {}), DbErrors);
+  EXPECT_THROW(m_ds->exec(insert, {field_value(1)}), DbErrors);
+}
+
+TEST_F(TestSqliteDataset, InlinedParameters)
+{
+  // datasets without native binding get the values escaped into the statement
+  const std::string sql = m_db.bind_params(
+      "SELECT * FROM path WHERE strPath = ? AND playCount = ? AND dateAdded = '?' AND "
+      "rating > ?",
+      {field_value("it's"), field_value(42), field_value(true)});
+  EXPECT_EQ(sql, "SELECT * FROM path WHERE strPath = 'it''s' AND playCount = 42 AND "
+                 "dateAdded = '?' AND rating > 1");
+  EXPECT_THROW(m_db.bind_params("SELECT ?", {}), DbErrors);
+}
+
+TEST_F(TestSqliteDataset, StatementCache)
+{
+  constexpr int ROWS = 1000;
+
+  m_db.start_transaction();
+  for (int i = 0; i < ROWS; ++i)
+    m_ds->exec("INSERT INTO path (strPath, playCount) VALUES (?, ?)",
+               {field_value("/path/" + std::to_string(i) + "/"), field_value(i)});
+  m_db.commit_transaction();
+
+  int found = 0;
+  for (int i = 0; i < ROWS; ++i)
+  {
+    m_ds->query(m_db.prepare("SELECT idPath FROM path WHERE strPath = '%s'",
+                             ("/path/" + std::to_string(i) + "/").c_str()));
+    found += m_ds->num_rows();
+    m_ds->close();
+  }
+  EXPECT_EQ(found, ROWS);
+
+  // the cached statement is reset and bound again for each query
+  found = 0;
+  for (int i = 0; i < ROWS; ++i)
+  {
+    m_ds->query("SELECT idPath FROM path WHERE strPath = ?",
+                {field_value("/path/" + std::to_string(i) + "/")});
+    found += m_ds->num_rows();
+    m_ds->close();
+  }
+  EXPECT_EQ(found, ROWS);
+
+  // nested use of the same statement from a second dataset
+  std::unique_ptr<Dataset> ds2(m_db.CreateDataset());
+  ASSERT_TRUE(m_ds->query("SELECT idPath FROM path WHERE playCount < ?", {field_value(3)}));
+  ASSERT_TRUE(ds2->query("SELECT idPath FROM path WHERE playCount < ?", {field_value(5)}));
+  EXPECT_EQ(m_ds->num_rows(), 3);
+  EXPECT_EQ(ds2->num_rows(), 5);
+}
+
+TEST_F(TestSqliteDataset, ColumnarResult)
+{
+  m_ds->exec("INSERT INTO path (strPath, dateAdded, playCount, rating) VALUES "
+             "('/tv/', NULL, 5, 2.5), ('/movies/', '2026-02-03', NULL, NULL)");
+
+  ASSERT_TRUE(
+      m_ds->query("SELECT strPath, dateAdded, playCount, rating FROM path ORDER BY idPath"));
+  const query_data& rows = m_ds->get_result_set().records;
+  ASSERT_EQ(rows.size(), 2u);
+  ASSERT_EQ(rows.num_columns(), 4u);
+
+  EXPECT_EQ(rows.get_string(0, 0), "/tv/");
+  EXPECT_TRUE(rows.is_null(0, 1));
+  EXPECT_EQ(rows.get_type(0, 2), ft_Int64);
+  EXPECT_EQ(rows.get_int64(0, 2), 5);
+  EXPECT_DOUBLE_EQ(rows.get_double(0, 3), 2.5);
+  EXPECT_EQ(rows.get_string(1, 1), "2026-02-03");
+  EXPECT_EQ(rows.get_int64(1, 1), 2026);
+  EXPECT_TRUE(rows.is_null(1, 2));
+  EXPECT_EQ(rows.get_int64(1, 2), 0);
+  EXPECT_DOUBLE_EQ(rows.get_double(1, 3), 0.0);
+
+  // the row based accessors see the same values
+  const sql_record* record = rows.at(1);
+  ASSERT_EQ(record->size(), 4u);
+  EXPECT_EQ(record->at(0).get_asString(), "/movies/");
+  EXPECT_FALSE(record->at(1).get_isNull());
+  EXPECT_TRUE(record->at(2).get_isNull());
+  EXPECT_EQ(rows[1], record);
+  EXPECT_THROW(rows.at(2), std::out_of_range);
+
+  EXPECT_EQ(m_ds->fv("strPath").get_asString(), "/tv/");
+  EXPECT_TRUE(m_ds->fv("dateAdded").get_isNull());
+  m_ds->next();
+  EXPECT_EQ(m_ds->fv("strPath").get_asString(), "/movies/");
+  EXPECT_FALSE(m_ds->fv("dateAdded").get_isNull());
+  EXPECT_EQ(m_ds->get_sql_record()->at(3).get_isNull(), true);
+  m_ds->close();
+
+  // rows stay valid until the row cache has been cycled
+  ASSERT_TRUE(m_ds->query("SELECT strPath FROM path ORDER BY idPath"));
+  const query_data& again = m_ds->get_result_set().records;
+  const sql_record* first = again[0];
+  const sql_record* second = again[1];
+  EXPECT_EQ(first->at(0).get_asString(), "/tv/");
+  EXPECT_EQ(second->at(0).get_asString(), "/movies/");
+}
+
+TEST_F(TestSqliteDataset, ColumnarResultOnlyNull)
+{
+  // nothing is stored in the text arena of the result
+  ASSERT_TRUE(m_ds->query("SELECT playCount, rating FROM path UNION ALL SELECT NULL, NULL"));
+  const query_data& rows = m_ds->get_result_set().records;
+  ASSERT_EQ(rows.size(), 1u);
+  EXPECT_TRUE(rows.is_null(0, 0));
+  EXPECT_EQ(rows.get_int64(0, 0), 0);
+  EXPECT_DOUBLE_EQ(rows.get_double(0, 1), 0.0);
+  EXPECT_EQ(rows.get_string(0, 1), "");
+}
@@ -360,7 +360,8 @@ bool CDoubleCache::Reset(int64_t iSourcePosition)
    */
   if (m_pCache->IsCachedPosition(iSourcePosition) &&
       (!m_pCacheOld || !m_pCacheOld->IsCachedPosition(iSourcePosition) ||
-       m_pCache->CachedDataEndPos() >= m_pCacheOld->CachedDataEndPos()))
+       m_pCache->CachedDataEndPosIfSeekTo(iSourcePosition) >=
+           m_pCacheOld->CachedDataEndPosIfSeekTo(iSourcePosition)))
   {
     // No swap: Just use current cache
     return m_pCache->Reset(iSourcePosition);
@@ -50,6 +50,8 @@ int CCircularCache::Open()
   m_beg = 0;
   m_end = 0;
   m_cur = 0;
+  m_segments.clear();
+  m_segmentsSize = 0;
   return CACHE_RC_OK;
 }
 
@@ -65,6 +67,8 @@ void CCircularCache::Close()
   delete[] m_buf;
 #endif
   m_buf = NULL;
+  m_segments.clear();
+  m_segmentsSize = 0;
 }
 
 size_t CCircularCache::GetMaxWriteSize(const size_t& iRequestSize)
@@ -238,22 +242,96 @@ int64_t CCircularCache::Seek(int64_t pos)
 bool CCircularCache::Reset(int64_t pos)
 {
   std::unique_lock<CCriticalSection> lock(m_sync);
-  if (IsCachedPosition(pos))
+  if (pos >= m_beg && pos <= m_end)
   {
     m_cur = pos;
     return false;
   }
+
+  CSegment segment{pos, {}};
+  const auto it = FindSegment(pos);
+  if (it != m_segments.end())
+  {
+    segment = std::move(*it);
+    m_segmentsSize -= segment.data.size();
+    m_segments.erase(it);
+  }
+
+  KeepSegment();
   m_end = pos;
   m_beg = pos;
   m_cur = pos;
 
-  return true;
+  if (segment.data.empty())
+    return true;
+
+  // move the segment back into the buffer, filling continues behind it
+  const size_t len = segment.data.size();
+  const size_t offset = static_cast<size_t>(segment.start % m_size);
+  const size_t first = std::min(len, m_size - offset);
+  memcpy(m_buf + offset, segment.data.data(), first);
+  memcpy(m_buf, segment.data.data() + first, len - first);
+  m_beg = segment.start;
+  m_end = segment.End();
+
+  CLog::Log(LOGDEBUG, "CCircularCache::{} - ({}) reusing {} bytes kept at {} for pos {}",
+            __FUNCTION__, fmt::ptr(this), len, m_beg, pos);
+
+  return false;
+}
+
+void CCircularCache::KeepSegment()
+{
+  // a segment can't take more than half of the budget, so that two regions can be kept, e.g. the
+  // head and the index at the end of the file
+  const int64_t maxLen = static_cast<int64_t>(m_size_back / 2);
+  const int64_t start = std::max(m_beg, m_cur - maxLen / 2);
+  const int64_t end = std::min(m_end, start + maxLen);
+  if (end <= start || m_buf == NULL)
+    return;
+
+  // the kept data replaces older segments covering the same region
+  for (auto it = m_segments.begin(); it != m_segments.end();)
+  {
+    if (it->start < end && it->End() > start)
+    {
+      m_segmentsSize -= it->data.size();
+      it = m_segments.erase(it);
+    }
+    else
+      ++it;
+  }
+
+  const size_t len = static_cast<size_t>(end - start);
+  const size_t offset = static_cast<size_t>(start % m_size);
+  const size_t first = std::min(len, m_size - offset);
+  CSegment segment{start, std::vector<uint8_t>(len)};
+  memcpy(segment.data.data(), m_buf + offset, first);
+  memcpy(segment.data.data() + first, m_buf, len - first);
+  m_segments.emplace_front(std::move(segment));
+  m_segmentsSize += len;
+
+  while (m_segmentsSize > m_size_back)
+  {
+    m_segmentsSize -= m_segments.back().data.size();
+    m_segments.pop_back();
+  }
+}
+
+std::list<CCircularCache::CSegment>::iterator CCircularCache::FindSegment(int64_t pos)
+{
+  return std::find_if(m_segments.begin(), m_segments.end(), [pos](const CSegment& segment)
+                      { return pos >= segment.start && pos <= segment.End(); });
 }
 
 int64_t CCircularCache::CachedDataEndPosIfSeekTo(int64_t iFilePosition)
 {
-  if (IsCachedPosition(iFilePosition))
+  std::unique_lock<CCriticalSection> lock(m_sync);
+  if (iFilePosition >= m_beg && iFilePosition <= m_end)
     return m_end;
+  const auto segment = FindSegment(iFilePosition);
+  if (segment != m_segments.end())
+    return segment->End();
   return iFilePosition;
 }
 
@@ -269,7 +347,9 @@ int64_t CCircularCache::CachedDataEndPos()
 
 bool CCircularCache::IsCachedPosition(int64_t iFilePosition)
 {
-  return iFilePosition >= m_beg && iFilePosition <= m_end;
+  std::unique_lock<CCriticalSection> lock(m_sync);
+  return (iFilePosition >= m_beg && iFilePosition <= m_end) ||
+         FindSegment(iFilePosition) != m_segments.end();
 }
 
 CCacheStrategy *CCircularCache::CreateNew()
@@ -12,8 +12,20 @@
 #include "threads/CriticalSection.h"
 #include "threads/Event.h"
 
+#include <list>
+#include <vector>
+
 namespace XFILE {
 
+/*!
+ \brief Memory cache strategy holding a window around the read position
+
+ On a reset to a position outside of the window, the data around the read position is kept in a
+ segment besides the window instead of being dropped. When the reader returns to a kept segment,
+ e.g. after the demuxer probed the index at the end of the file, the segment is moved back into the
+ window and filling continues behind it. The segments use at most the size of the back buffer, the
+ least recently used ones are dropped first.
+ */
 class CCircularCache : public CCacheStrategy
 {
 public:
@@ -38,6 +50,19 @@ public:
 
     CCacheStrategy *CreateNew() override;
 protected:
+  struct CSegment
+  {
+    int64_t start;
+    std::vector<uint8_t> data;
+
+    int64_t End() const { return start + static_cast<int64_t>(data.size()); }
+  };
+
+  /*! \brief Keep the data around the read position in a segment, the window is reused after */
+  void KeepSegment();
+  std::list<CSegment>::iterator FindSegment(int64_t pos);
+
+
   int64_t m_beg = 0; /**< index in file (not buffer) of beginning of valid data */
   int64_t m_end = 0; /**< index in file (not buffer) of end of valid data */
   int64_t m_cur = 0; /**< current reading index in file */
@@ -46,6 +71,8 @@ protected:
     size_t            m_size_back; /**< guaranteed size of back buffer (actual size can be smaller, or larger if front buffer doesn't need it) */
     CCriticalSection  m_sync;
     CEvent            m_written;
+    std::list<CSegment> m_segments; /**< kept data of former windows, most recently used first */
+    size_t            m_segmentsSize = 0; /**< bytes held by m_segments */
 #ifdef TARGET_WINDOWS
     HANDLE            m_handle;
 #endif
@@ -491,6 +491,10 @@ void CCurlFile::SetCommonOptions(CReadState* state, bool failOnError /* = true *
   // use DNS cache
   g_curlInterface.easy_setopt(h, CURLOPT_RESOLVE, m_dnsCacheList);
 
+  // share name lookups and TLS sessions with the other handles
+  if (g_curlInterface.GetShare())
+    g_curlInterface.easy_setopt(h, CURLOPT_SHARE, g_curlInterface.GetShare());
+
   // make sure headers are separated from the data stream
   g_curlInterface.easy_setopt(h, CURLOPT_WRITEHEADER, state);
   g_curlInterface.easy_setopt(h, CURLOPT_HEADERFUNCTION, header_callback);
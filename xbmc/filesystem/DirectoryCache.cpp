@@ -12,68 +12,68 @@
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "URL.h"
+#include "music/tags/MusicInfoTag.h"
+#include "pictures/PictureInfoTag.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/log.h"
+#include "video/VideoInfoTag.h"
 
 #include <algorithm>
-#include <climits>
+#include <functional>
 #include <mutex>
 
-// Maximum number of directories to keep in our cache
-#define MAX_CACHED_DIRS 50
-
 using namespace XFILE;
 
 CDirectoryCache::CDir::CDir(DIR_CACHE_TYPE cacheType) : m_Items(std::make_unique<CFileItemList>())
 {
   m_cacheType = cacheType;
-  m_lastAccess = 0;
   m_Items->SetIgnoreURLOptions(true);
   m_Items->SetFastLookup(true);
 }
 
 CDirectoryCache::CDir::~CDir() = default;
 
-void CDirectoryCache::CDir::SetLastAccess(unsigned int &accessCounter)
+void CDirectoryCache::CDir::SetLastAccess(std::atomic<uint64_t>& accessCounter)
 {
   m_lastAccess = accessCounter++;
 }
 
-CDirectoryCache::CDirectoryCache(void)
+CDirectoryCache::CDirectoryCache(size_t maxSize /* = DEFAULT_MAX_SIZE */) : m_maxSize(maxSize)
 {
-  m_accessCounter = 0;
-#ifdef _DEBUG
-  m_cacheHits = 0;
-  m_cacheMisses = 0;
-#endif
 }
 
 CDirectoryCache::~CDirectoryCache(void) = default;
 
-bool CDirectoryCache::GetDirectory(const std::string& strPath, CFileItemList &items, bool retrieveAll)
+CDirectoryCache::CShard& CDirectoryCache::GetShard(const std::string& storedPath)
 {
-  std::unique_lock<CCriticalSection> lock(m_cs);
+  return m_shards[std::hash<std::string>{}(storedPath) % NUM_SHARDS];
+}
 
+bool CDirectoryCache::GetDirectory(const std::string& strPath, CFileItemList &items, bool retrieveAll)
+{
   // Get rid of any URL options, else the compare may be wrong
   std::string storedPath = CURL(strPath).GetWithoutOptions();
   URIUtils::RemoveSlashAtEnd(storedPath);
 
-  auto i = m_cache.find(storedPath);
-  if (i != m_cache.end())
+  CShard& shard = GetShard(storedPath);
+  std::unique_lock<CCriticalSection> lock(shard.m_cs);
+
+  auto i = shard.m_index.find(storedPath);
+  if (i != shard.m_index.end())
   {
-    CDir& dir = i->second;
+    CDir& dir = i->second->second;
     if (dir.m_cacheType == XFILE::DIR_CACHE_ALWAYS ||
         (dir.m_cacheType == XFILE::DIR_CACHE_ONCE && retrieveAll))
     {
       items.Copy(*dir.m_Items);
       dir.SetLastAccess(m_accessCounter);
-#ifdef _DEBUG
-      m_cacheHits+=items.Size();
-#endif
+      shard.m_lru.splice(shard.m_lru.begin(), shard.m_lru, i->second);
+      m_cacheHits++;
       return true;
     }
   }
+  m_cacheMisses++;
   return false;
 }
 
@@ -93,20 +93,35 @@ void CDirectoryCache::SetDirectory(const std::string& strPath, const CFileItemLi
   // IDEALLY, any further processing on the item would actually create a new item
   // instead of altering it, but we can't really enforce that in an easy way, so
   // this is the best solution for now.
-  std::unique_lock<CCriticalSection> lock(m_cs);
 
   // Get rid of any URL options, else the compare may be wrong
   std::string storedPath = CURL(strPath).GetWithoutOptions();
   URIUtils::RemoveSlashAtEnd(storedPath);
 
-  ClearDirectory(storedPath);
-
-  CheckIfFull();
-
+  // copy the listing before taking the lock, big folders take a while
   CDir dir(cacheType);
   dir.m_Items->Copy(items);
-  dir.SetLastAccess(m_accessCounter);
-  m_cache.emplace(storedPath, std::move(dir));
+  for (const auto& item : *dir.m_Items)
+    dir.m_size += GetItemSize(*item);
+
+  uint64_t lastAccess;
+  {
+    CShard& shard = GetShard(storedPath);
+    std::unique_lock<CCriticalSection> lock(shard.m_cs);
+
+    auto i = shard.m_index.find(storedPath);
+    if (i != shard.m_index.end())
+      Erase(shard, i->second);
+
+    dir.SetLastAccess(m_accessCounter);
+    lastAccess = dir.GetLastAccess();
+    if (cacheType != DIR_CACHE_ALWAYS)
+      m_size += dir.m_size;
+    shard.m_lru.emplace_front(storedPath, std::move(dir));
+    shard.m_index.emplace(storedPath, shard.m_lru.begin());
+  }
+
+  CheckIfFull(lastAccess);
 }
 
 void CDirectoryCache::ClearFile(const std::string& strFile)
@@ -120,53 +135,63 @@ void CDirectoryCache::ClearFile(const std::string& strFile)
 
 void CDirectoryCache::ClearDirectory(const std::string& strPath)
 {
-  std::unique_lock<CCriticalSection> lock(m_cs);
-
   // Get rid of any URL options, else the compare may be wrong
   std::string storedPath = CURL(strPath).GetWithoutOptions();
   URIUtils::RemoveSlashAtEnd(storedPath);
 
-  m_cache.erase(storedPath);
+  CShard& shard = GetShard(storedPath);
+  std::unique_lock<CCriticalSection> lock(shard.m_cs);
+
+  auto i = shard.m_index.find(storedPath);
+  if (i != shard.m_index.end())
+    Erase(shard, i->second);
 }
 
 void CDirectoryCache::ClearSubPaths(const std::string& strPath)
 {
-  std::unique_lock<CCriticalSection> lock(m_cs);
-
   // Get rid of any URL options, else the compare may be wrong
   std::string storedPath = CURL(strPath).GetWithoutOptions();
 
-  auto i = m_cache.begin();
-  while (i != m_cache.end())
+  for (auto& shard : m_shards)
   {
-    if (URIUtils::PathHasParent(i->first, storedPath))
-      m_cache.erase(i++);
-    else
-      i++;
+    std::unique_lock<CCriticalSection> lock(shard.m_cs);
+    auto i = shard.m_lru.begin();
+    while (i != shard.m_lru.end())
+    {
+      if (URIUtils::PathHasParent(i->first, storedPath))
+        Erase(shard, i++);
+      else
+        i++;
+    }
   }
 }
 
 void CDirectoryCache::AddFile(const std::string& strFile)
 {
-  std::unique_lock<CCriticalSection> lock(m_cs);
-
   // Get rid of any URL options, else the compare may be wrong
   std::string strPath = URIUtils::GetDirectory(CURL(strFile).GetWithoutOptions());
   URIUtils::RemoveSlashAtEnd(strPath);
 
-  auto i = m_cache.find(strPath);
-  if (i != m_cache.end())
+  CShard& shard = GetShard(strPath);
+  std::unique_lock<CCriticalSection> lock(shard.m_cs);
+
+  auto i = shard.m_index.find(strPath);
+  if (i != shard.m_index.end())
   {
-    CDir& dir = i->second;
+    CDir& dir = i->second->second;
     CFileItemPtr item(new CFileItem(strFile, false));
+    const size_t size = GetItemSize(*item);
     dir.m_Items->Add(item);
+    dir.m_size += size;
+    if (dir.m_cacheType != DIR_CACHE_ALWAYS)
+      m_size += size;
     dir.SetLastAccess(m_accessCounter);
+    shard.m_lru.splice(shard.m_lru.begin(), shard.m_lru, i->second);
   }
 }
 
 bool CDirectoryCache::FileExists(const std::string& strFile, bool& bInCache)
 {
-  std::unique_lock<CCriticalSection> lock(m_cs);
   bInCache = false;
 
   // Get rid of any URL options, else the compare may be wrong
@@ -175,28 +200,32 @@ bool CDirectoryCache::FileExists(const std::string& strFile, bool& bInCache)
   std::string storedPath = URIUtils::GetDirectory(strPath);
   URIUtils::RemoveSlashAtEnd(storedPath);
 
-  auto i = m_cache.find(storedPath);
-  if (i != m_cache.end())
+  CShard& shard = GetShard(storedPath);
+  std::unique_lock<CCriticalSection> lock(shard.m_cs);
+
+  auto i = shard.m_index.find(storedPath);
+  if (i != shard.m_index.end())
   {
     bInCache = true;
-    CDir& dir = i->second;
+    CDir& dir = i->second->second;
     dir.SetLastAccess(m_accessCounter);
-#ifdef _DEBUG
+    shard.m_lru.splice(shard.m_lru.begin(), shard.m_lru, i->second);
     m_cacheHits++;
-#endif
     return (URIUtils::PathEquals(strPath, storedPath) || dir.m_Items->Contains(strFile));
   }
-#ifdef _DEBUG
   m_cacheMisses++;
-#endif
   return false;
 }
 
 void CDirectoryCache::Clear()
 {
   // this routine clears everything
-  std::unique_lock<CCriticalSection> lock(m_cs);
-  m_cache.clear();
+  for (auto& shard : m_shards)
+  {
+    std::unique_lock<CCriticalSection> lock(shard.m_cs);
+    while (!shard.m_lru.empty())
+      Erase(shard, shard.m_lru.begin());
+  }
 }
 
 void CDirectoryCache::InitCache(const std::set<std::string>& dirs)
@@ -211,56 +240,111 @@ void CDirectoryCache::InitCache(const std::set<std::string>& dirs)
 
 void CDirectoryCache::ClearCache(std::set<std::string>& dirs)
 {
-  auto i = m_cache.begin();
-  while (i != m_cache.end())
+  for (const std::string& dir : dirs)
   {
-    if (dirs.find(i->first) != dirs.end())
-      m_cache.erase(i++);
-    else
-      i++;
+    CShard& shard = GetShard(dir);
+    std::unique_lock<CCriticalSection> lock(shard.m_cs);
+    auto i = shard.m_index.find(dir);
+    if (i != shard.m_index.end())
+      Erase(shard, i->second);
   }
 }
 
-void CDirectoryCache::CheckIfFull()
+void CDirectoryCache::Erase(CShard& shard, CShard::LRUList::iterator it)
 {
-  std::unique_lock<CCriticalSection> lock(m_cs);
+  if (it->second.m_cacheType != DIR_CACHE_ALWAYS)
+    m_size -= it->second.m_size;
+  shard.m_index.erase(it->first);
+  shard.m_lru.erase(it);
+}
 
-  // find the last accessed folder, and remove if the number of cached folders is too many
-  auto lastAccessed = m_cache.end();
-  unsigned int numCached = 0;
-  for (auto i = m_cache.begin(); i != m_cache.end(); i++)
+void CDirectoryCache::CheckIfFull(uint64_t newestAccess)
+{
+  // evict the least recently used folder of all shards until the cache fits into its budget.
+  // Folders accessed after newestAccess are kept, so a folder bigger than the whole budget
+  // still stays cached until the next one is added.
+  while (m_size > m_maxSize)
   {
-    // ensure dirs that are always cached aren't cleared
-    if (i->second.m_cacheType != DIR_CACHE_ALWAYS)
+    CShard* oldestShard = nullptr;
+    uint64_t oldestAccess = newestAccess;
+    for (auto& shard : m_shards)
+    {
+      std::unique_lock<CCriticalSection> lock(shard.m_cs);
+      // ensure dirs that are always cached aren't cleared
+      for (auto i = shard.m_lru.rbegin(); i != shard.m_lru.rend(); ++i)
+      {
+        if (i->second.m_cacheType != DIR_CACHE_ALWAYS)
+        {
+          if (i->second.GetLastAccess() < oldestAccess)
+          {
+            oldestAccess = i->second.GetLastAccess();
+            oldestShard = &shard;
+          }
+          break;
+        }
+      }
+    }
+    if (!oldestShard)
+      break;
+
+    // another thread may have used or removed the folder in the meantime
+    std::unique_lock<CCriticalSection> lock(oldestShard->m_cs);
+    for (auto i = oldestShard->m_lru.rbegin(); i != oldestShard->m_lru.rend(); ++i)
     {
-      if (lastAccessed == m_cache.end() ||
-          i->second.GetLastAccess() < lastAccessed->second.GetLastAccess())
-        lastAccessed = i;
-      numCached++;
+      if (i->second.m_cacheType != DIR_CACHE_ALWAYS)
+      {
+        if (i->second.GetLastAccess() == oldestAccess)
+        {
+          Erase(*oldestShard, std::next(i).base());
+          m_evictions++;
+        }
+        break;
+      }
     }
   }
-  if (lastAccessed != m_cache.end() && numCached >= MAX_CACHED_DIRS)
-    m_cache.erase(lastAccessed);
 }
 
-#ifdef _DEBUG
-void CDirectoryCache::PrintStats() const
+size_t CDirectoryCache::GetItemSize(const CFileItem& item)
+{
+  size_t size = sizeof(CFileItem) + item.GetPath().size() + item.GetDynPath().size() +
+                item.GetLabel().size() + item.GetLabel2().size();
+  for (const auto& art : item.GetArt())
+    size += art.first.size() + art.second.size();
+  if (item.HasVideoInfoTag())
+    size += sizeof(CVideoInfoTag);
+  if (item.HasMusicInfoTag())
+    size += sizeof(MUSIC_INFO::CMusicInfoTag);
+  if (item.HasPictureInfoTag())
+    size += sizeof(CPictureInfoTag);
+  return size;
+}
+
+CDirectoryCache::Stats CDirectoryCache::GetStats() const
 {
-  std::unique_lock<CCriticalSection> lock(m_cs);
-  CLog::Log(LOGDEBUG, "{} - total of {} cache hits, and {} cache misses", __FUNCTION__, m_cacheHits,
-            m_cacheMisses);
-  // run through and find the oldest and the number of items cached
-  unsigned int oldest = UINT_MAX;
-  unsigned int numItems = 0;
-  unsigned int numDirs = 0;
-  for (auto i = m_cache.begin(); i != m_cache.end(); i++)
+  Stats stats;
+  stats.hits = m_cacheHits;
+  stats.misses = m_cacheMisses;
+  stats.evictions = m_evictions;
+  for (const auto& shard : m_shards)
   {
-    const CDir& dir = i->second;
-    oldest = std::min(oldest, dir.GetLastAccess());
-    numItems += dir.m_Items->Size();
-    numDirs++;
+    std::unique_lock<CCriticalSection> lock(shard.m_cs);
+    for (const auto& dir : shard.m_lru)
+    {
+      stats.directories++;
+      stats.items += dir.second.m_Items->Size();
+      stats.size += dir.second.m_size;
+    }
   }
-  CLog::Log(LOGDEBUG, "{} - {} folders cached, with {} items total.  Oldest is {}, current is {}",
-            __FUNCTION__, numDirs, numItems, oldest, m_accessCounter);
+  return stats;
+}
+
+#ifdef _DEBUG
+void CDirectoryCache::PrintStats() const
+{
+  const Stats stats = GetStats();
+  CLog::Log(LOGDEBUG, "{} - total of {} cache hits, {} cache misses and {} evictions",
+            __FUNCTION__, stats.hits, stats.misses, stats.evictions);
+  CLog::Log(LOGDEBUG, "{} - {} folders cached, with {} items total using {} of {} bytes",
+            __FUNCTION__, stats.directories, stats.items, stats.size, m_maxSize);
 }
 #endif
@@ -11,14 +11,28 @@
 #include "IDirectory.h"
 #include "threads/CriticalSection.h"
 
-#include <map>
+#include <array>
+#include <atomic>
+#include <list>
 #include <memory>
 #include <set>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
 
 class CFileItem;
 
 namespace XFILE
 {
+  /*!
+   \brief Cache of directory listings
+
+   The listings are spread over a number of shards, each with its own lock, so that lookups of
+   different directories don't contend. Every shard keeps its listings in least recently used
+   order. Once the approximate memory use of the cached CFileItemLists exceeds the byte budget
+   the oldest of the shard tails is evicted until it fits again. Listings cached with
+   DIR_CACHE_ALWAYS are never evicted and don't count against the budget.
+   */
   class CDirectoryCache
   {
     class CDir
@@ -29,18 +43,41 @@ namespace XFILE
       CDir& operator=(CDir&& dir) = default;
       virtual ~CDir();
 
-      void SetLastAccess(unsigned int &accessCounter);
-      unsigned int GetLastAccess() const { return m_lastAccess; }
+      void SetLastAccess(std::atomic<uint64_t>& accessCounter);
+      uint64_t GetLastAccess() const { return m_lastAccess; }
 
       std::unique_ptr<CFileItemList> m_Items;
       DIR_CACHE_TYPE m_cacheType;
+      size_t m_size = 0; //!< approximate memory used by m_Items
     private:
       CDir(const CDir&) = delete;
       CDir& operator=(const CDir&) = delete;
-      unsigned int m_lastAccess;
+      uint64_t m_lastAccess = 0;
+    };
+
+    struct CShard
+    {
+      using LRUList = std::list<std::pair<std::string, CDir>>;
+
+      mutable CCriticalSection m_cs;
+      LRUList m_lru; //!< most recently used first
+      std::unordered_map<std::string, LRUList::iterator> m_index;
     };
+
   public:
-    CDirectoryCache(void);
+    static constexpr size_t DEFAULT_MAX_SIZE = 32 * 1024 * 1024;
+
+    struct Stats
+    {
+      uint64_t hits = 0;
+      uint64_t misses = 0;
+      uint64_t evictions = 0;
+      size_t directories = 0;
+      size_t items = 0;
+      size_t size = 0; //!< approximate bytes used by all cached listings
+    };
+
+    explicit CDirectoryCache(size_t maxSize = DEFAULT_MAX_SIZE);
     virtual ~CDirectoryCache(void);
     bool GetDirectory(const std::string& strPath, CFileItemList &items, bool retrieveAll = false);
     void SetDirectory(const std::string& strPath, const CFileItemList &items, DIR_CACHE_TYPE cacheType);
@@ -50,24 +87,32 @@ namespace XFILE
     void Clear();
     void AddFile(const std::string& strFile);
     bool FileExists(const std::string& strPath, bool& bInCache);
+    Stats GetStats() const;
 #ifdef _DEBUG
     void PrintStats() const;
 #endif
+
+    /*! \brief Approximate number of bytes a cached copy of the item uses */
+    static size_t GetItemSize(const CFileItem& item);
+
   protected:
+    static constexpr size_t NUM_SHARDS = 16;
+
     void InitCache(const std::set<std::string>& dirs);
     void ClearCache(std::set<std::string>& dirs);
-    void CheckIfFull();
-
-    std::map<std::string, CDir> m_cache;
 
-    mutable CCriticalSection m_cs;
+    CShard& GetShard(const std::string& storedPath);
+    void Erase(CShard& shard, CShard::LRUList::iterator it);
+    void CheckIfFull(uint64_t newestAccess);
 
-    unsigned int m_accessCounter;
+    std::array<CShard, NUM_SHARDS> m_shards;
+    const size_t m_maxSize;
+    std::atomic<size_t> m_size{0}; //!< bytes used by the listings that can be evicted
+    std::atomic<uint64_t> m_accessCounter{0};
 
-#ifdef _DEBUG
-    unsigned int m_cacheHits;
-    unsigned int m_cacheMisses;
-#endif
+    std::atomic<uint64_t> m_cacheHits{0};
+    std::atomic<uint64_t> m_cacheMisses{0};
+    std::atomic<uint64_t> m_evictions{0};
   };
 }
 extern XFILE::CDirectoryCache g_directoryCache;
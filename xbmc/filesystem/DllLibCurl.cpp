@@ -97,6 +97,16 @@ CURLMcode DllLibCurl::multi_cleanup(CURLM* handle)
   return curl_multi_cleanup(handle);
 }
 
+CURLSH* DllLibCurl::share_init()
+{
+  return curl_share_init();
+}
+
+CURLSHcode DllLibCurl::share_cleanup(CURLSH* share)
+{
+  return curl_share_cleanup(share);
+}
+
 curl_slist* DllLibCurl::slist_append(curl_slist* list, const char* to_append)
 {
   return curl_slist_append(list, to_append);
@@ -118,6 +128,21 @@ DllLibCurlGlobal::DllLibCurlGlobal()
   if (curl_global_init(CURL_GLOBAL_ALL))
   {
     CLog::Log(LOGERROR, "Error initializing libcurl");
+    return;
+  }
+
+  // scraping and artwork caching do many short requests to the same hosts, sharing the name
+  // lookups and TLS sessions between the handles saves most of the handshakes. The connection
+  // cache isn't shared: the handles are driven by their own multi handles from many threads at
+  // once, which libcurl doesn't support for shared connections.
+  m_share = share_init();
+  if (m_share)
+  {
+    share_setopt(m_share, CURLSHOPT_LOCKFUNC, ShareLock);
+    share_setopt(m_share, CURLSHOPT_UNLOCKFUNC, ShareUnlock);
+    share_setopt(m_share, CURLSHOPT_USERDATA, this);
+    share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    share_setopt(m_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
   }
 }
 
@@ -132,15 +157,31 @@ DllLibCurlGlobal::~DllLibCurlGlobal()
     if (session.m_multi)
       multi_cleanup(session.m_multi);
   }
+  if (m_share)
+    share_cleanup(m_share);
   // close libcurl
   curl_global_cleanup();
 }
 
+void DllLibCurlGlobal::ShareLock(CURL_HANDLE* handle,
+                                 curl_lock_data data,
+                                 curl_lock_access access,
+                                 void* userptr)
+{
+  static_cast<DllLibCurlGlobal*>(userptr)->m_shareLocks[data].lock();
+}
+
+void DllLibCurlGlobal::ShareUnlock(CURL_HANDLE* handle, curl_lock_data data, void* userptr)
+{
+  static_cast<DllLibCurlGlobal*>(userptr)->m_shareLocks[data].unlock();
+}
+
 void DllLibCurlGlobal::CheckIdle()
 {
   std::unique_lock<CCriticalSection> lock(m_critSection);
   /* 20 seconds idle time before closing handle */
   const unsigned int idletime = 30000;
+  bool closed = false;
 
   VEC_CURLSESSIONS::iterator it = m_sessions.begin();
   while (it != m_sessions.end())
@@ -162,10 +203,16 @@ void DllLibCurlGlobal::CheckIdle()
         multi_cleanup(it->m_multi);
 
       it = m_sessions.erase(it);
+      closed = true;
       continue;
     }
     ++it;
   }
+
+  const unsigned int transfers = m_transfers;
+  if (closed && transfers > 0)
+    CLog::Log(LOGDEBUG, "{} - {} of {} transfers reused a connection ({}%)", __FUNCTION__,
+              m_reusedConnections.load(), transfers, m_reusedConnections * 100 / transfers);
 }
 
 void DllLibCurlGlobal::easy_acquire(const char* protocol,
@@ -252,6 +299,17 @@ void DllLibCurlGlobal::easy_release(CURL_HANDLE** easy_handle, CURLM** multi_han
   {
     if (it.m_easy == easy && (multi == nullptr || it.m_multi == multi))
     {
+      // a transfer which didn't need a new connection reused the one of the session
+      long response = 0;
+      long connects = 0;
+      if (easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &response) == CURLE_OK && response != 0 &&
+          easy_getinfo(easy, CURLINFO_NUM_CONNECTS, &connects) == CURLE_OK)
+      {
+        ++m_transfers;
+        if (connects == 0)
+          ++m_reusedConnections;
+      }
+
       /* reset session so next caller doesn't reuse options, only connections */
       /* will reset verbose too so it won't print that it closed connections on cleanup*/
       easy_reset(easy);
@@ -10,6 +10,8 @@
 
 #include "threads/CriticalSection.h"
 
+#include <array>
+#include <atomic>
 #include <stdio.h>
 #include <string>
 #include <sys/time.h>
@@ -59,6 +61,13 @@ public:
   CURLMcode multi_timeout(CURLM* multi_handle, long* timeout);
   CURLMsg* multi_info_read(CURLM* multi_handle, int* msgs_in_queue);
   CURLMcode multi_cleanup(CURLM* handle);
+  CURLSH* share_init();
+  template<typename... Args>
+  CURLSHcode share_setopt(CURLSH* share, CURLSHoption option, Args... args)
+  {
+    return curl_share_setopt(share, option, std::forward<Args>(args)...);
+  }
+  CURLSHcode share_cleanup(CURLSH* share);
   curl_slist* slist_append(curl_slist* list, const char* to_append);
   void slist_free_all(curl_slist* list);
   const char* easy_strerror(CURLcode code);
@@ -82,6 +91,12 @@ public:
   CURL_HANDLE* easy_duphandle(CURL_HANDLE* easy_handle) override;
   void CheckIdle();
 
+  /*!
+   \brief Handle sharing the DNS cache and TLS sessions between all easy handles
+   \return the share handle to set as CURLOPT_SHARE or nullptr if sharing isn't available
+   */
+  CURLSH* GetShare() const { return m_share; }
+
   /* overloaded load and unload with reference counter */
 
   /* structure holding a session info */
@@ -100,6 +115,22 @@ public:
 
   VEC_CURLSESSIONS m_sessions;
   CCriticalSection m_critSection;
+
+private:
+  friend class TestDllLibCurlHelper;
+
+  static void ShareLock(CURL_HANDLE* handle,
+                        curl_lock_data data,
+                        curl_lock_access access,
+                        void* userptr);
+  static void ShareUnlock(CURL_HANDLE* handle, curl_lock_data data, void* userptr);
+
+  CURLSH* m_share = nullptr;
+  std::array<CCriticalSection, CURL_LOCK_DATA_LAST> m_shareLocks;
+
+  // transfers done with the session handles and how many of them reused a connection
+  std::atomic<unsigned int> m_transfers{0};
+  std::atomic<unsigned int> m_reusedConnections{0};
 };
 } // namespace XCURL
 
@@ -9,11 +9,14 @@
 #include "FileCache.h"
 
 #include "CircularCache.h"
+#include "PersistentFileCache.h"
 #include "ServiceBroker.h"
 #include "URL.h"
+#include "settings/AdvancedSettings.h"
 #include "settings/Settings.h"
 #include "settings/SettingsComponent.h"
 #include "threads/Thread.h"
+#include "utils/URIUtils.h"
 #include "utils/log.h"
 
 #include <mutex>
@@ -135,16 +138,38 @@ bool CFileCache::Open(const CURL& url)
 
   m_fileSize = m_source.GetLength();
 
+  CPersistentFileCache* persistentCache = nullptr;
   if (!m_pCache)
   {
-    if (cacheMemSize == 0)
+    // keep the data of seekable sources of a known size for later sessions if enabled
+    const std::shared_ptr<CAdvancedSettings> advancedSettings =
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+    struct __stat64 st;
+    if (advancedSettings->m_persistentCacheSize > 0 && m_fileSize > 0 && m_seekPossible &&
+        m_source.Stat(&st) == 0 && st.st_mtime != 0)
+    {
+      m_pCache = CPersistentFileCache::Create(
+          URIUtils::AddFileToFolder(advancedSettings->m_cachePath, "filecache/"),
+          url.GetWithoutUserDetails(), static_cast<int64_t>(st.st_mtime), m_fileSize,
+          static_cast<int64_t>(advancedSettings->m_persistentCacheSize) * 1024 * 1024);
+      if (m_pCache)
+      {
+        persistentCache = static_cast<CPersistentFileCache*>(m_pCache.get());
+        CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> using persistent disk cache", __FUNCTION__,
+                  m_sourcePath);
+        m_forwardCacheSize = 0;
+        m_maxForward = m_fileSize;
+      }
+    }
+
+    if (!m_pCache && cacheMemSize == 0)
     {
       // Use cache on disk
       m_pCache = std::make_unique<CSimpleFileCache>();
       m_forwardCacheSize = 0;
       m_maxForward = m_fileSize;
     }
-    else
+    else if (!m_pCache)
     {
       size_t cacheSize;
       if (m_fileSize > 0 && m_fileSize < cacheMemSize && !(m_flags & READ_AUDIO_VIDEO))
@@ -212,6 +237,24 @@ bool CFileCache::Open(const CURL& url)
   m_seekEvent.Reset();
   m_seekEnded.Reset();
 
+  // continue reading the source behind the data cached in an earlier session
+  const int64_t cachedEnd = m_pCache->CachedDataEndPosIfSeekTo(0);
+  if (cachedEnd > 0 && (cachedEnd == m_fileSize || m_source.Seek(cachedEnd, SEEK_SET) == cachedEnd))
+  {
+    m_pCache->Reset(0);
+    m_writePos = m_pCache->CachedDataEndPos();
+    CLog::Log(LOGDEBUG, "CFileCache::{} - <{}> {} bytes cached already", __FUNCTION__,
+              m_sourcePath, m_writePos);
+  }
+  else if (cachedEnd > 0 && persistentCache)
+  {
+    // the writer starts at the beginning of the source, the cached data would be overwritten with
+    // the wrong bytes otherwise
+    CLog::Log(LOGWARNING, "CFileCache::{} - <{}> failed to seek behind the cached data",
+              __FUNCTION__, m_sourcePath);
+    persistentCache->Discard();
+  }
+
   CThread::Create(false);
 
   return true;
@@ -421,6 +464,19 @@ void CFileCache::Process()
 
     m_writePos += iTotalWrite;
 
+    // the written data may have reached data cached before, the source continues behind it
+    const int64_t cachedEnd = m_pCache->CachedDataEndPos();
+    if (cachedEnd > m_writePos)
+    {
+      if (cachedEnd < m_fileSize && m_source.Seek(cachedEnd, SEEK_SET) != cachedEnd)
+      {
+        CLog::Log(LOGERROR, "CFileCache::{} - <{}> error seeking to the end of cached data {}",
+                  __FUNCTION__, m_sourcePath, cachedEnd);
+        break;
+      }
+      m_writePos = cachedEnd;
+    }
+
     // under estimate write rate by a second, to
     // avoid uncertainty at start of caching
     m_writeRateActual = average.Rate(m_writePos, 1000);
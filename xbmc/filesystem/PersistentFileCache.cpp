@@ -0,0 +1,732 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "PersistentFileCache.h"
+
+#include "Directory.h"
+#include "File.h"
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "IFile.h"
+#include "SpecialProtocol.h"
+#include "URL.h"
+#include "threads/SystemClock.h"
+#include "utils/Crc32.h"
+#include "utils/StringUtils.h"
+#include "utils/URIUtils.h"
+#include "utils/log.h"
+#if defined(TARGET_POSIX)
+#include "platform/posix/filesystem/PosixFile.h"
+#define CacheLocalFile CPosixFile
+#elif defined(TARGET_WINDOWS)
+#include "platform/win32/filesystem/Win32File.h"
+#define CacheLocalFile CWin32File
+#endif // TARGET_WINDOWS
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <mutex>
+#include <set>
+#include <vector>
+
+using namespace XFILE;
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr char INDEX_MAGIC[4] = {'K', 'P', 'F', 'C'};
+constexpr uint32_t INDEX_VERSION = 2;
+constexpr uint32_t INDEX_VERSION_OPEN = 0; //!< never valid, the index of a cache in use
+
+// the cache files which are in use, a source can only be written by one stream at a time
+CCriticalSection inUseSection;
+std::set<std::string> inUse;
+
+template<typename T>
+bool ReadValue(CFile& file, T& value)
+{
+  return file.Read(&value, sizeof(value)) == static_cast<ssize_t>(sizeof(value));
+}
+
+template<typename T>
+bool WriteValue(CFile& file, const T& value)
+{
+  return file.Write(&value, sizeof(value)) == static_cast<ssize_t>(sizeof(value));
+}
+
+/*!
+ \brief Read the header of an index file
+ \return the key of the source or an empty string if the file isn't a valid index
+ */
+std::string ReadHeader(CFile& file, int64_t& fileSize, uint64_t& blocks, uint32_t& slotCount)
+{
+  char magic[sizeof(INDEX_MAGIC)];
+  uint32_t version;
+  int64_t blockSize;
+  uint32_t keyLength;
+  if (file.Read(magic, sizeof(magic)) != sizeof(magic) ||
+      std::memcmp(magic, INDEX_MAGIC, sizeof(magic)) != 0 || !ReadValue(file, version) ||
+      version != INDEX_VERSION || !ReadValue(file, fileSize) || !ReadValue(file, blockSize) ||
+      blockSize != CPersistentFileCache::BLOCK_SIZE || !ReadValue(file, keyLength) ||
+      keyLength == 0 || keyLength > 4096)
+    return {};
+
+  std::string key(keyLength, '\0');
+  if (file.Read(key.data(), keyLength) != static_cast<ssize_t>(keyLength) ||
+      !ReadValue(file, blocks) ||
+      blocks != static_cast<uint64_t>((fileSize + CPersistentFileCache::BLOCK_SIZE - 1) /
+                                      CPersistentFileCache::BLOCK_SIZE) ||
+      !ReadValue(file, slotCount))
+    return {};
+
+  return key;
+}
+} // namespace
+
+std::unique_ptr<CPersistentFileCache> CPersistentFileCache::Create(const std::string& directory,
+                                                                   const std::string& source,
+                                                                   int64_t modified,
+                                                                   int64_t fileSize,
+                                                                   int64_t budget)
+{
+  if (source.empty() || fileSize <= 0 || budget <= 0)
+    return {};
+
+  // the files are named after the source only, so that they are replaced when it changes
+  const std::string name = StringUtils::Format("{:08x}", Crc32::Compute(source));
+  const std::string key = StringUtils::Format("{}|{}", source, modified);
+  {
+    std::unique_lock<CCriticalSection> lock(inUseSection);
+    if (!inUse.insert(name).second)
+      return {};
+  }
+
+  if (!CDirectory::Exists(directory) && !CDirectory::Create(directory))
+  {
+    CLog::Log(LOGERROR, "CPersistentFileCache::{} - unable to create {}", __FUNCTION__, directory);
+    std::unique_lock<CCriticalSection> lock(inUseSection);
+    inUse.erase(name);
+    return {};
+  }
+
+  return std::unique_ptr<CPersistentFileCache>(
+      new CPersistentFileCache(directory, name, key, fileSize, budget));
+}
+
+CPersistentFileCache::CPersistentFileCache(const std::string& directory,
+                                           const std::string& name,
+                                           const std::string& key,
+                                           int64_t fileSize,
+                                           int64_t budget)
+  : m_directory(directory),
+    m_name(name),
+    m_key(key),
+    m_fileSize(fileSize),
+    m_budget(budget),
+    m_cacheFileRead(std::make_unique<CacheLocalFile>()),
+    m_cacheFileWrite(std::make_unique<CacheLocalFile>())
+{
+}
+
+CPersistentFileCache::~CPersistentFileCache()
+{
+  Close();
+
+  std::unique_lock<CCriticalSection> lock(inUseSection);
+  inUse.erase(m_name);
+}
+
+int CPersistentFileCache::Open()
+{
+  Close();
+
+  // data without a valid index is of no use
+  const bool valid = ReadIndex();
+  const CURL fileURL(CSpecialProtocol::TranslatePath(
+      URIUtils::AddFileToFolder(m_directory, m_name + ".cache")));
+
+  // the slots of indexed blocks are reused while the cache is open, if it isn't closed properly
+  // the next session must not map the blocks to them
+  if (!m_cacheFileWrite->OpenForWrite(fileURL, !valid) || !m_cacheFileRead->Open(fileURL) ||
+      !InvalidateIndex())
+  {
+    CLog::Log(LOGERROR, "CPersistentFileCache::{} - failed to open \"{}\"", __FUNCTION__,
+              fileURL.Get());
+    m_cacheFileWrite->Close();
+    m_cacheFileRead->Close();
+    Discard();
+    return CACHE_RC_ERROR;
+  }
+
+  if (valid)
+    CLog::Log(LOGDEBUG, "CPersistentFileCache::{} - reusing {} cached ranges of \"{}\"",
+              __FUNCTION__, m_ranges.size(), m_name);
+
+  m_othersSize = Trim(static_cast<int64_t>(m_slotCount) * BLOCK_SIZE);
+  m_othersTrimmed = false;
+  m_readPosition = 0;
+  m_writePosition = 0;
+  m_fileReadPosition = -1;
+  m_bEndOfInput = false;
+  m_open = true;
+  return CACHE_RC_OK;
+}
+
+void CPersistentFileCache::Close()
+{
+  if (!m_open)
+    return;
+
+  m_open = false;
+  m_cacheFileWrite->Close();
+  m_cacheFileRead->Close();
+
+  int64_t size;
+  {
+    std::unique_lock<CCriticalSection> lock(m_critSection);
+    if (!WriteIndex())
+      CLog::Log(LOGWARNING, "CPersistentFileCache::{} - failed to write the index of \"{}\"",
+                __FUNCTION__, m_name);
+    m_ranges.clear();
+    size = static_cast<int64_t>(m_slotCount) * BLOCK_SIZE;
+  }
+
+  Trim(size);
+}
+
+void CPersistentFileCache::Discard()
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  m_ranges.clear();
+  m_slots.assign(m_slots.size(), -1);
+  m_freeSlots.clear();
+  for (int32_t slot = m_slotCount - 1; slot >= 0; --slot)
+    m_freeSlots.push_back(slot);
+  m_readPosition = 0;
+  m_writePosition = 0;
+}
+
+bool CPersistentFileCache::ReadIndex()
+{
+  const uint64_t blocks = static_cast<uint64_t>((m_fileSize + BLOCK_SIZE - 1) / BLOCK_SIZE);
+  m_ranges.clear();
+  m_slots.assign(blocks, -1);
+  m_freeSlots.clear();
+  m_slotCount = 0;
+
+  CFile file;
+  if (!file.Open(URIUtils::AddFileToFolder(m_directory, m_name + ".index")))
+    return false;
+
+  // an index exceeding the budget is dropped rather than trimmed
+  int64_t fileSize;
+  uint64_t indexBlocks;
+  uint32_t slotCount;
+  if (ReadHeader(file, fileSize, indexBlocks, slotCount) != m_key || fileSize != m_fileSize ||
+      static_cast<int64_t>(slotCount) > std::max<int64_t>(MIN_SLOTS, m_budget / BLOCK_SIZE))
+    return false;
+
+  std::vector<int32_t> slots(blocks);
+  const ssize_t size = static_cast<ssize_t>(slots.size() * sizeof(int32_t));
+  if (file.Read(slots.data(), size) != size)
+    return false;
+
+  std::vector<bool> used(slotCount);
+  for (const int32_t slot : slots)
+  {
+    if (slot >= static_cast<int32_t>(slotCount) || (slot >= 0 && used[slot]))
+      return false;
+    if (slot >= 0)
+      used[slot] = true;
+  }
+
+  for (uint64_t block = 0; block < blocks; ++block)
+  {
+    if (slots[block] < 0)
+      continue;
+    const int64_t start = static_cast<int64_t>(block) * BLOCK_SIZE;
+    AddRange(start, std::min(start + BLOCK_SIZE, m_fileSize));
+  }
+  m_slots = std::move(slots);
+  m_slotCount = static_cast<int32_t>(slotCount);
+
+  // the slots of incomplete blocks are reused
+  for (int32_t slot = m_slotCount - 1; slot >= 0; --slot)
+  {
+    if (!used[slot])
+      m_freeSlots.push_back(slot);
+  }
+  return true;
+}
+
+bool CPersistentFileCache::InvalidateIndex() const
+{
+  CFile file;
+  return file.OpenForWrite(URIUtils::AddFileToFolder(m_directory, m_name + ".index"), true) &&
+         file.Write(INDEX_MAGIC, sizeof(INDEX_MAGIC)) == sizeof(INDEX_MAGIC) &&
+         WriteValue(file, INDEX_VERSION_OPEN);
+}
+
+bool CPersistentFileCache::WriteIndex() const
+{
+  // only complete blocks are recorded, the data around them may be missing
+  const uint64_t blocks = static_cast<uint64_t>((m_fileSize + BLOCK_SIZE - 1) / BLOCK_SIZE);
+  std::vector<int32_t> slots(blocks, -1);
+  for (uint64_t block = 0; block < std::min(blocks, static_cast<uint64_t>(m_slots.size()));
+       ++block)
+  {
+    const int64_t start = static_cast<int64_t>(block) * BLOCK_SIZE;
+    const auto range = FindRange(start);
+    if (m_slots[block] >= 0 && range != m_ranges.end() &&
+        range->second >= std::min(start + BLOCK_SIZE, m_fileSize))
+      slots[block] = m_slots[block];
+  }
+
+  CFile file;
+  if (!file.OpenForWrite(URIUtils::AddFileToFolder(m_directory, m_name + ".index"), true))
+    return false;
+
+  const uint32_t keyLength = static_cast<uint32_t>(m_key.size());
+  const uint32_t slotCount = static_cast<uint32_t>(m_slotCount);
+  const ssize_t size = static_cast<ssize_t>(slots.size() * sizeof(int32_t));
+  return file.Write(INDEX_MAGIC, sizeof(INDEX_MAGIC)) == sizeof(INDEX_MAGIC) &&
+         WriteValue(file, INDEX_VERSION) && WriteValue(file, m_fileSize) &&
+         WriteValue(file, BLOCK_SIZE) && WriteValue(file, keyLength) &&
+         file.Write(m_key.data(), keyLength) == static_cast<ssize_t>(keyLength) &&
+         WriteValue(file, blocks) && WriteValue(file, slotCount) &&
+         file.Write(slots.data(), size) == size;
+}
+
+int64_t CPersistentFileCache::Trim(int64_t size) const
+{
+  CFileItemList items;
+  if (!CDirectory::GetDirectory(m_directory, items, ".index", DIR_FLAG_BYPASS_CACHE))
+    return 0;
+
+  struct CEntry
+  {
+    std::string name;
+    std::string path;
+    CDateTime lastUsed;
+    int64_t size;
+  };
+  std::vector<CEntry> entries;
+  int64_t others = 0;
+  for (const auto& item : items)
+  {
+    const std::string name =
+        URIUtils::GetFileName(URIUtils::ReplaceExtension(item->GetPath(), ""));
+    if (name == m_name)
+      continue;
+
+    // the index is written on close, its time is the last use of the cache
+    struct __stat64 st;
+    const int64_t cacheSize = CFile::Stat(URIUtils::ReplaceExtension(item->GetPath(), ".cache"),
+                                          &st) == 0
+                                  ? st.st_size
+                                  : 0;
+    entries.push_back({name, item->GetPath(), item->m_dateTime, cacheSize});
+    others += cacheSize;
+  }
+
+  // the least recently used first
+  std::sort(entries.begin(), entries.end(),
+            [](const CEntry& a, const CEntry& b) { return a.lastUsed < b.lastUsed; });
+
+  for (const CEntry& entry : entries)
+  {
+    if (others + size <= m_budget)
+      break;
+    // the files of an open cache are written again on close, so other streams are left alone
+    {
+      std::unique_lock<CCriticalSection> lock(inUseSection);
+      if (inUse.find(entry.name) != inUse.end())
+        continue;
+    }
+
+    CLog::Log(LOGDEBUG, "CPersistentFileCache::{} - removing \"{}\" with {} bytes", __FUNCTION__,
+              entry.name, entry.size);
+    CFile::Delete(URIUtils::ReplaceExtension(entry.path, ".cache"));
+    CFile::Delete(entry.path);
+    others -= entry.size;
+  }
+  return others;
+}
+
+bool CPersistentFileCache::CanGrow()
+{
+  if (m_slotCount < MIN_SLOTS)
+    return true;
+
+  const int64_t size = static_cast<int64_t>(m_slotCount + 1) * BLOCK_SIZE;
+  if (size > m_budget)
+    return false;
+
+  // the other caches give up their space once, after that the blocks of this one are reused
+  if (m_othersSize + size > m_budget && !m_othersTrimmed)
+  {
+    m_othersSize = Trim(size);
+    m_othersTrimmed = true;
+  }
+  return m_othersSize + size <= m_budget;
+}
+
+int64_t CPersistentFileCache::FindVictim(int64_t block) const
+{
+  // the blocks between the reader and the writer are kept, the ones the reader passed go first
+  const int64_t readBlock = m_readPosition / BLOCK_SIZE;
+  const int64_t first = std::min(readBlock, block);
+  const int64_t last = std::max(readBlock, block);
+  const int64_t blocks = static_cast<int64_t>(m_slots.size());
+  for (int64_t victim = 0; victim < std::min(first, blocks); ++victim)
+  {
+    if (m_slots[victim] >= 0)
+      return victim;
+  }
+  for (int64_t victim = blocks - 1; victim > last; --victim)
+  {
+    if (m_slots[victim] >= 0)
+      return victim;
+  }
+  return -1;
+}
+
+bool CPersistentFileCache::CanAcquireSlot(int64_t block)
+{
+  return (block < static_cast<int64_t>(m_slots.size()) && m_slots[block] >= 0) ||
+         !m_freeSlots.empty() || CanGrow() || FindVictim(block) >= 0;
+}
+
+int32_t CPersistentFileCache::AcquireSlot(int64_t block)
+{
+  if (block >= static_cast<int64_t>(m_slots.size()))
+    m_slots.resize(block + 1, -1);
+  if (m_slots[block] >= 0)
+    return m_slots[block];
+
+  int32_t slot;
+  if (!m_freeSlots.empty())
+  {
+    slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+  }
+  else if (CanGrow())
+  {
+    slot = m_slotCount++;
+  }
+  else
+  {
+    const int64_t victim = FindVictim(block);
+    if (victim < 0)
+      return -1;
+    slot = m_slots[victim];
+    m_slots[victim] = -1;
+    RemoveRange(victim * BLOCK_SIZE, (victim + 1) * BLOCK_SIZE);
+  }
+
+  m_slots[block] = slot;
+  return slot;
+}
+
+void CPersistentFileCache::AddRange(int64_t start, int64_t end)
+{
+  if (start >= end)
+    return;
+
+  auto it = m_ranges.upper_bound(start);
+  if (it != m_ranges.begin())
+  {
+    const auto previous = std::prev(it);
+    if (previous->second >= start)
+    {
+      start = previous->first;
+      end = std::max(end, previous->second);
+      m_ranges.erase(previous);
+    }
+  }
+  while (it != m_ranges.end() && it->first <= end)
+  {
+    end = std::max(end, it->second);
+    it = m_ranges.erase(it);
+  }
+  m_ranges.emplace(start, end);
+}
+
+void CPersistentFileCache::RemoveRange(int64_t start, int64_t end)
+{
+  auto it = m_ranges.upper_bound(start);
+  if (it != m_ranges.begin() && std::prev(it)->second > start)
+    --it;
+  while (it != m_ranges.end() && it->first < end)
+  {
+    const auto [rangeStart, rangeEnd] = *it;
+    it = m_ranges.erase(it);
+    if (rangeStart < start)
+      m_ranges.emplace(rangeStart, start);
+    if (rangeEnd > end)
+      it = m_ranges.emplace(end, rangeEnd).first;
+  }
+}
+
+std::map<int64_t, int64_t>::const_iterator CPersistentFileCache::FindRange(int64_t position) const
+{
+  auto it = m_ranges.upper_bound(position);
+  if (it == m_ranges.begin())
+    return m_ranges.end();
+  --it;
+  return position <= it->second ? it : m_ranges.end();
+}
+
+int64_t CPersistentFileCache::GetRangeEnd(int64_t position) const
+{
+  const auto it = FindRange(position);
+  return it != m_ranges.end() ? it->second : position;
+}
+
+int64_t CPersistentFileCache::GetAvailableRead() const
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  return GetRangeEnd(m_readPosition) - m_readPosition;
+}
+
+size_t CPersistentFileCache::GetMaxWriteSize(const size_t& iRequestSize)
+{
+  // the writer waits for the reader when the budget is used up by the blocks in between
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  return CanAcquireSlot(GetRangeEnd(m_writePosition) / BLOCK_SIZE) ? iRequestSize : 0;
+}
+
+int CPersistentFileCache::WriteToCache(const char* pBuffer, size_t iSize)
+{
+  int64_t start;
+  {
+    std::unique_lock<CCriticalSection> lock(m_critSection);
+    start = GetRangeEnd(m_writePosition);
+  }
+
+  // each block of the source is written to its own slot of the cache file
+  size_t written = 0;
+  while (written < iSize)
+  {
+    const int64_t position = start + static_cast<int64_t>(written);
+    const int64_t block = position / BLOCK_SIZE;
+    int64_t offset;
+    {
+      std::unique_lock<CCriticalSection> lock(m_critSection);
+      const int32_t slot = AcquireSlot(block);
+      if (slot < 0)
+        break;
+      offset = static_cast<int64_t>(slot) * BLOCK_SIZE + position % BLOCK_SIZE;
+    }
+
+    if (m_cacheFileWrite->Seek(offset, SEEK_SET) != offset)
+    {
+      CLog::Log(LOGERROR, "CPersistentFileCache::{} - <{}> failed to seek to {}", __FUNCTION__,
+                m_name, offset);
+      return CACHE_RC_ERROR;
+    }
+
+    const size_t size = std::min(iSize - written,
+                                 static_cast<size_t>((block + 1) * BLOCK_SIZE - position));
+    size_t blockWritten = 0;
+    while (blockWritten < size)
+    {
+      const ssize_t lastWritten =
+          m_cacheFileWrite->Write(pBuffer + written + blockWritten, size - blockWritten);
+      if (lastWritten <= 0)
+      {
+        CLog::Log(LOGERROR, "CPersistentFileCache::{} - <{}> failed to write to cache",
+                  __FUNCTION__, m_name);
+        return CACHE_RC_ERROR;
+      }
+      blockWritten += lastWritten;
+    }
+
+    {
+      std::unique_lock<CCriticalSection> lock(m_critSection);
+      AddRange(position, position + size);
+      m_writePosition = position + size;
+    }
+    written += size;
+  }
+
+  // when reader waits for data it will wait on the event.
+  if (written > 0)
+    m_dataAvail.Set();
+
+  return written;
+}
+
+int CPersistentFileCache::ReadFromCache(char* pBuffer, size_t iMaxSize)
+{
+  size_t readBytes = 0;
+  while (readBytes < iMaxSize)
+  {
+    int64_t offset;
+    size_t toRead;
+    {
+      std::unique_lock<CCriticalSection> lock(m_critSection);
+      const int64_t position = m_readPosition;
+      const int64_t available = GetRangeEnd(position) - position;
+      const int64_t block = position / BLOCK_SIZE;
+      if (available <= 0 || block >= static_cast<int64_t>(m_slots.size()) || m_slots[block] < 0)
+        break;
+      offset = static_cast<int64_t>(m_slots[block]) * BLOCK_SIZE + position % BLOCK_SIZE;
+      toRead = static_cast<size_t>(
+          std::min({static_cast<int64_t>(iMaxSize - readBytes), available,
+                    (block + 1) * BLOCK_SIZE - position}));
+    }
+
+    if (m_fileReadPosition != offset)
+    {
+      m_fileReadPosition = m_cacheFileRead->Seek(offset, SEEK_SET);
+      if (m_fileReadPosition != offset)
+      {
+        CLog::Log(LOGERROR, "CPersistentFileCache::{} - <{}> failed to seek to {}", __FUNCTION__,
+                  m_name, offset);
+        return CACHE_RC_ERROR;
+      }
+    }
+
+    size_t blockRead = 0;
+    while (blockRead < toRead)
+    {
+      const ssize_t lastRead =
+          m_cacheFileRead->Read(pBuffer + readBytes + blockRead, toRead - blockRead);
+      if (lastRead == 0)
+        break;
+      if (lastRead < 0)
+      {
+        CLog::Log(LOGERROR, "CPersistentFileCache::{} - <{}> failed to read from cache",
+                  __FUNCTION__, m_name);
+        m_fileReadPosition = -1;
+        return CACHE_RC_ERROR;
+      }
+      blockRead += lastRead;
+    }
+
+    m_fileReadPosition += blockRead;
+    {
+      std::unique_lock<CCriticalSection> lock(m_critSection);
+      m_readPosition += blockRead;
+    }
+    readBytes += blockRead;
+    if (blockRead < toRead)
+      break;
+  }
+
+  if (readBytes == 0)
+    return m_bEndOfInput ? 0 : CACHE_RC_WOULD_BLOCK;
+
+  // the writer may be waiting for the blocks the reader passed
+  m_space.Set();
+
+  return readBytes;
+}
+
+int64_t CPersistentFileCache::WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout)
+{
+  if (timeout == 0ms || IsEndOfInput())
+    return GetAvailableRead();
+
+  XbmcThreads::EndTime<> endTime{timeout};
+  while (!IsEndOfInput())
+  {
+    const int64_t available = GetAvailableRead();
+    if (available >= iMinAvail)
+      return available;
+
+    if (!m_dataAvail.Wait(endTime.GetTimeLeft()))
+      return CACHE_RC_TIMEOUT;
+  }
+  return GetAvailableRead();
+}
+
+int64_t CPersistentFileCache::Seek(int64_t iFilePosition)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+
+  // the reader may only move within the data the writer is extending, other cached ranges need a
+  // reset to move the writer along
+  const auto range = FindRange(m_writePosition);
+  const int64_t start = range != m_ranges.end() ? range->first : m_writePosition;
+  const int64_t end = GetRangeEnd(m_writePosition);
+  if (iFilePosition < start || iFilePosition - end > 500000)
+    return CACHE_RC_ERROR;
+
+  if (iFilePosition > end)
+  {
+    const int64_t readPosition = m_readPosition;
+    lock.unlock();
+    if (WaitForData(static_cast<uint32_t>(iFilePosition - readPosition), 5s) <
+        iFilePosition - readPosition)
+    {
+      CLog::Log(LOGDEBUG, "CPersistentFileCache::{} - <{}> wait for position {} failed",
+                __FUNCTION__, m_name, iFilePosition);
+      return CACHE_RC_ERROR;
+    }
+    lock.lock();
+  }
+
+  m_readPosition = iFilePosition;
+  m_space.Set();
+
+  return iFilePosition;
+}
+
+bool CPersistentFileCache::Reset(int64_t iSourcePosition)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  m_readPosition = iSourcePosition;
+  if (FindRange(iSourcePosition) != m_ranges.end() || iSourcePosition == m_writePosition)
+  {
+    m_writePosition = GetRangeEnd(iSourcePosition);
+    return false;
+  }
+
+  m_writePosition = iSourcePosition;
+  return true;
+}
+
+void CPersistentFileCache::EndOfInput()
+{
+  CCacheStrategy::EndOfInput();
+  m_dataAvail.Set();
+}
+
+int64_t CPersistentFileCache::CachedDataEndPosIfSeekTo(int64_t iFilePosition)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  return GetRangeEnd(iFilePosition);
+}
+
+int64_t CPersistentFileCache::CachedDataStartPos()
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  const auto range = FindRange(m_readPosition);
+  return range != m_ranges.end() ? range->first : m_readPosition;
+}
+
+int64_t CPersistentFileCache::CachedDataEndPos()
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  return GetRangeEnd(m_writePosition);
+}
+
+bool CPersistentFileCache::IsCachedPosition(int64_t iFilePosition)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  return FindRange(iFilePosition) != m_ranges.end() || iFilePosition == m_writePosition;
+}
+
+CCacheStrategy* CPersistentFileCache::CreateNew()
+{
+  return new CSimpleFileCache();
+}
@@ -0,0 +1,141 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "CacheStrategy.h"
+#include "threads/CriticalSection.h"
+
+#include <map>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace XFILE
+{
+class IFile;
+
+/*!
+ \brief Disk cache strategy which keeps the cached data of a file for later sessions
+
+ The data is stored in slots of BLOCK_SIZE in the cache file, each holding one block of the
+ source. The ranges cached in this session are tracked exactly, complete blocks and their slots
+ are recorded in an index file on Close() so that they are available when the same source
+ (identified by its url, size and modification time) is opened again. The index is invalid while
+ the cache is open, the data of a session which wasn't closed is dropped.
+
+ The cache files of all sources share a budget. The files of other sources used least recently
+ are deleted first when it is exceeded, after that the writer reuses the slots of blocks the
+ reader has passed or of blocks far ahead of it. It waits for the reader when all slots hold data
+ between the two, see GetMaxWriteSize().
+
+ The writer always appends to the end of the cached data following its position. CFileCache
+ skips the source ahead when the written data joins data cached before, see CachedDataEndPos().
+ */
+class CPersistentFileCache : public CCacheStrategy
+{
+public:
+  static constexpr int64_t BLOCK_SIZE = 1024 * 1024;
+  static constexpr int32_t MIN_SLOTS = 2; //!< slots used even if the budget is smaller
+
+  /*!
+   \brief Create the cache for a source
+   \param directory folder holding the cache files
+   \param source url of the source without user details
+   \param modified modification time of the source, the data cached before is dropped on changes
+   \param fileSize size of the source
+   \param budget maximum number of bytes kept in the directory for all sources
+   \return the cache or nullptr if the cache of the source is in use by another stream
+   */
+  static std::unique_ptr<CPersistentFileCache> Create(const std::string& directory,
+                                                      const std::string& source,
+                                                      int64_t modified,
+                                                      int64_t fileSize,
+                                                      int64_t budget);
+  ~CPersistentFileCache() override;
+
+  int Open() override;
+  void Close() override;
+
+  size_t GetMaxWriteSize(const size_t& iRequestSize) override;
+  int WriteToCache(const char* pBuffer, size_t iSize) override;
+  int ReadFromCache(char* pBuffer, size_t iMaxSize) override;
+  int64_t WaitForData(uint32_t iMinAvail, std::chrono::milliseconds timeout) override;
+
+  int64_t Seek(int64_t iFilePosition) override;
+  bool Reset(int64_t iSourcePosition) override;
+  void EndOfInput() override;
+
+  int64_t CachedDataEndPosIfSeekTo(int64_t iFilePosition) override;
+  int64_t CachedDataStartPos() override;
+  int64_t CachedDataEndPos() override;
+  bool IsCachedPosition(int64_t iFilePosition) override;
+
+  /*!
+   \brief Drop all cached data, e.g. when the source can't continue behind it
+   */
+  void Discard();
+
+  /*! \brief Creates a temporary CSimpleFileCache, the persistent data can have one writer only */
+  CCacheStrategy* CreateNew() override;
+
+private:
+  CPersistentFileCache(const std::string& directory,
+                       const std::string& name,
+                       const std::string& key,
+                       int64_t fileSize,
+                       int64_t budget);
+  CPersistentFileCache(const CPersistentFileCache&) = delete;
+  CPersistentFileCache& operator=(const CPersistentFileCache&) = delete;
+
+  bool ReadIndex();
+  bool WriteIndex() const;
+  bool InvalidateIndex() const; //!< until the valid index is written on Close()
+
+  /*!
+   \brief Delete the least recently used caches of other sources until the budget fits
+   \param size number of bytes needed by this cache
+   \return number of bytes kept for the other caches
+   */
+  int64_t Trim(int64_t size) const;
+
+  bool CanGrow();
+  int64_t FindVictim(int64_t block) const;
+  bool CanAcquireSlot(int64_t block);
+  int32_t AcquireSlot(int64_t block);
+
+  void AddRange(int64_t start, int64_t end);
+  void RemoveRange(int64_t start, int64_t end);
+  std::map<int64_t, int64_t>::const_iterator FindRange(int64_t position) const;
+  int64_t GetRangeEnd(int64_t position) const;
+  int64_t GetAvailableRead() const;
+
+  const std::string m_directory;
+  const std::string m_name; //!< name of the cache files without extension
+  const std::string m_key; //!< source and modification time the cached data belongs to
+  const int64_t m_fileSize;
+  const int64_t m_budget;
+
+  std::unique_ptr<IFile> m_cacheFileRead;
+  std::unique_ptr<IFile> m_cacheFileWrite;
+  CEvent m_dataAvail;
+
+  mutable CCriticalSection m_critSection;
+  std::map<int64_t, int64_t> m_ranges; //!< cached data, end by start, adjacent ranges are joined
+  std::vector<int32_t> m_slots; //!< slot of each block of the source, -1 if it has none
+  std::vector<int32_t> m_freeSlots;
+  int32_t m_slotCount = 0; //!< number of slots in the cache file
+  int64_t m_othersSize = 0; //!< bytes used by the caches of other sources
+  bool m_othersTrimmed = false;
+  int64_t m_readPosition = 0;
+  int64_t m_writePosition = 0;
+  int64_t m_fileReadPosition = -1; //!< position of m_cacheFileRead
+  bool m_open = false;
+};
+} // namespace XFILE
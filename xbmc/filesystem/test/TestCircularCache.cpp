@@ -0,0 +1,104 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/CircularCache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+class TestCircularCache : public ::testing::Test
+{
+protected:
+  TestCircularCache() : m_data(1024 * 1024)
+  {
+    for (size_t i = 0; i < m_data.size(); ++i)
+      m_data[i] = static_cast<char>(i * 13 % 253);
+  }
+
+  void Fill(CCacheStrategy& cache, int64_t end)
+  {
+    for (int64_t pos = cache.CachedDataEndPos(); pos < end;)
+    {
+      const size_t len = cache.GetMaxWriteSize(std::min<int64_t>(4096, end - pos));
+      const int written = cache.WriteToCache(m_data.data() + pos, len);
+      ASSERT_GT(written, 0);
+      pos += written;
+    }
+  }
+
+  void Read(CCacheStrategy& cache, int64_t pos, size_t len)
+  {
+    ASSERT_EQ(pos, cache.Seek(pos));
+    std::vector<char> buffer(len);
+    for (size_t done = 0; done < len;)
+    {
+      const int read = cache.ReadFromCache(buffer.data() + done, len - done);
+      ASSERT_GT(read, 0);
+      done += read;
+    }
+    EXPECT_EQ(0, memcmp(buffer.data(), m_data.data() + pos, len));
+  }
+
+  std::vector<char> m_data;
+};
+} // namespace
+
+TEST_F(TestCircularCache, KeepSegments)
+{
+  // a segment holds at most half of the back buffer
+  CCircularCache cache(48 * 1024, 16 * 1024);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+  Fill(cache, 40000);
+  Read(cache, 0, 3000);
+
+  // probing the end of the file keeps the head
+  const int64_t tail = 1000000;
+  EXPECT_EQ(CACHE_RC_ERROR, cache.Seek(tail));
+  EXPECT_EQ(tail, cache.CachedDataEndPosIfSeekTo(tail));
+  EXPECT_TRUE(cache.Reset(tail));
+  Fill(cache, tail + 30000);
+  Read(cache, tail + 100, 5000);
+
+  // returning to the head continues behind the kept data
+  EXPECT_TRUE(cache.IsCachedPosition(100));
+  EXPECT_EQ(8192, cache.CachedDataEndPosIfSeekTo(100));
+  EXPECT_FALSE(cache.Reset(100));
+  EXPECT_EQ(8192, cache.CachedDataEndPos());
+  Read(cache, 100, 8000);
+  Fill(cache, 30000);
+  Read(cache, 8000, 20000);
+
+  // the tail was kept as well
+  const int64_t end = cache.CachedDataEndPosIfSeekTo(tail + 5000);
+  EXPECT_GT(end, tail + 5000);
+  EXPECT_FALSE(cache.Reset(tail + 5000));
+  Read(cache, tail + 5000, end - tail - 5000);
+
+  EXPECT_TRUE(cache.Reset(500000));
+  EXPECT_EQ(500000, cache.CachedDataEndPos());
+}
+
+TEST_F(TestCircularCache, KeepSegmentAtWrapPoint)
+{
+  CCircularCache cache(5000, 4096);
+  ASSERT_EQ(CACHE_RC_OK, cache.Open());
+  EXPECT_TRUE(cache.Reset(7000));
+  Fill(cache, 9000);
+  Read(cache, 7000, 1000);
+
+  EXPECT_TRUE(cache.Reset(100000));
+  EXPECT_FALSE(cache.Reset(7100));
+  Read(cache, 7100, 900);
+}
@@ -0,0 +1,170 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "filesystem/DirectoryCache.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+std::string FolderPath(int folder)
+{
+  return "smb://server/share/folder" + std::to_string(folder) + "/";
+}
+
+std::unique_ptr<CFileItemList> MakeListing(int folder, int files)
+{
+  auto items = std::make_unique<CFileItemList>();
+  for (int i = 0; i < files; ++i)
+    items->Add(std::make_shared<CFileItem>(FolderPath(folder) + "file" + std::to_string(i) + ".mkv",
+                                           false));
+  return items;
+}
+
+size_t ListingSize(const CFileItemList& items)
+{
+  size_t size = 0;
+  for (const auto& item : items)
+    size += CDirectoryCache::GetItemSize(*item);
+  return size;
+}
+} // namespace
+
+TEST(TestDirectoryCache, GetAndClear)
+{
+  CDirectoryCache cache;
+  CFileItemList items;
+  EXPECT_FALSE(cache.GetDirectory(FolderPath(1), items));
+
+  cache.SetDirectory(FolderPath(1), *MakeListing(1, 10), DIR_CACHE_ALWAYS);
+  cache.SetDirectory(FolderPath(2) + "?option=1", *MakeListing(2, 5), DIR_CACHE_ONCE);
+
+  // the trailing slash and URL options are ignored
+  ASSERT_TRUE(cache.GetDirectory("smb://server/share/folder1", items));
+  EXPECT_EQ(items.Size(), 10);
+  EXPECT_FALSE(cache.GetDirectory(FolderPath(2), items));
+  ASSERT_TRUE(cache.GetDirectory(FolderPath(2), items, true));
+  EXPECT_EQ(items.Size(), 5);
+
+  bool inCache = false;
+  EXPECT_TRUE(cache.FileExists(FolderPath(1) + "file3.mkv", inCache));
+  EXPECT_TRUE(inCache);
+  EXPECT_FALSE(cache.FileExists(FolderPath(1) + "missing.mkv", inCache));
+  EXPECT_TRUE(inCache);
+  cache.AddFile(FolderPath(1) + "missing.mkv");
+  EXPECT_TRUE(cache.FileExists(FolderPath(1) + "missing.mkv", inCache));
+  EXPECT_FALSE(cache.FileExists(FolderPath(3) + "file1.mkv", inCache));
+  EXPECT_FALSE(inCache);
+
+  cache.ClearFile(FolderPath(1) + "file1.mkv");
+  EXPECT_FALSE(cache.GetDirectory(FolderPath(1), items));
+  cache.ClearSubPaths("smb://server/share/");
+  EXPECT_FALSE(cache.GetDirectory(FolderPath(2), items, true));
+
+  const CDirectoryCache::Stats stats = cache.GetStats();
+  EXPECT_EQ(stats.directories, 0u);
+  EXPECT_EQ(stats.size, 0u);
+  EXPECT_EQ(stats.hits, 5u);
+  EXPECT_EQ(stats.misses, 5u);
+}
+
+TEST(TestDirectoryCache, EvictsLeastRecentlyUsedBySize)
+{
+  const size_t folderSize = ListingSize(*MakeListing(0, 100));
+  CDirectoryCache cache(folderSize * 4 + folderSize / 2);
+  CFileItemList items;
+
+  // a folder that is cached for good doesn't count against the budget
+  cache.SetDirectory("smb://server/share/", *MakeListing(100, 100), DIR_CACHE_ALWAYS);
+  for (int i = 0; i < 4; ++i)
+    cache.SetDirectory(FolderPath(i), *MakeListing(i, 100), DIR_CACHE_ONCE);
+  EXPECT_EQ(cache.GetStats().evictions, 0u);
+
+  // folder0 is used again, so folder1 is the least recently used one
+  ASSERT_TRUE(cache.GetDirectory(FolderPath(0), items, true));
+  cache.SetDirectory(FolderPath(4), *MakeListing(4, 100), DIR_CACHE_ONCE);
+  EXPECT_EQ(cache.GetStats().evictions, 1u);
+  EXPECT_FALSE(cache.GetDirectory(FolderPath(1), items, true));
+  EXPECT_TRUE(cache.GetDirectory(FolderPath(0), items, true));
+  EXPECT_TRUE(cache.GetDirectory(FolderPath(4), items, true));
+
+  // a single big folder pushes out several small ones, but is cached itself
+  cache.SetDirectory(FolderPath(5), *MakeListing(5, 300), DIR_CACHE_ONCE);
+  EXPECT_TRUE(cache.GetDirectory(FolderPath(5), items, true));
+  EXPECT_EQ(items.Size(), 300);
+  EXPECT_TRUE(cache.GetDirectory("smb://server/share/", items));
+
+  const CDirectoryCache::Stats stats = cache.GetStats();
+  EXPECT_EQ(stats.evictions, 4u);
+  EXPECT_EQ(stats.directories, 3u);
+  EXPECT_LE(stats.size - ListingSize(*MakeListing(100, 100)), folderSize * 4 + folderSize / 2);
+
+  // a folder bigger than the whole budget stays until the next one is added
+  cache.SetDirectory(FolderPath(6), *MakeListing(6, 1000), DIR_CACHE_ONCE);
+  EXPECT_TRUE(cache.GetDirectory(FolderPath(6), items, true));
+  cache.SetDirectory(FolderPath(7), *MakeListing(7, 10), DIR_CACHE_ONCE);
+  EXPECT_FALSE(cache.GetDirectory(FolderPath(6), items, true));
+  EXPECT_TRUE(cache.GetDirectory(FolderPath(7), items, true));
+}
+
+TEST(TestDirectoryCache, ConcurrentAccess)
+{
+  // lookups of the folders kept always succeed while a scanner fills the cache
+  constexpr int FOLDERS = 64;
+  constexpr int READERS = 4;
+  constexpr int LOOKUPS = 2000;
+
+  CDirectoryCache cache;
+  size_t alwaysSize = 0;
+  for (int i = 0; i < FOLDERS; ++i)
+  {
+    const auto items = MakeListing(i, 20);
+    cache.SetDirectory(FolderPath(i), *items, DIR_CACHE_ALWAYS);
+    alwaysSize += ListingSize(*items);
+  }
+
+  std::atomic<bool> stop{false};
+  std::thread scanner([&cache, &stop]() {
+    const auto big = MakeListing(1000, 10000);
+    int folder = FOLDERS;
+    while (!stop)
+      cache.SetDirectory(FolderPath(folder++ % 1000 + FOLDERS), *big, DIR_CACHE_ONCE);
+  });
+
+  std::atomic<int> errors{0};
+  std::vector<std::thread> readers;
+  for (int r = 0; r < READERS; ++r)
+  {
+    readers.emplace_back([&cache, &errors, r]() {
+      bool inCache;
+      for (int i = 0; i < LOOKUPS; ++i)
+      {
+        const int folder = (i + r) % FOLDERS;
+        if (!cache.FileExists(FolderPath(folder) + "file7.mkv", inCache) || !inCache)
+          errors++;
+      }
+    });
+  }
+  for (auto& reader : readers)
+    reader.join();
+  stop = true;
+  scanner.join();
+
+  EXPECT_EQ(errors, 0);
+  EXPECT_LE(cache.GetStats().size - alwaysSize, CDirectoryCache::DEFAULT_MAX_SIZE);
+}
@@ -0,0 +1,77 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "filesystem/DllLibCurl.h"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace XCURL
+{
+class TestDllLibCurlHelper
+{
+public:
+  static void Lock(curl_lock_data data)
+  {
+    DllLibCurlGlobal::ShareLock(nullptr, data, CURL_LOCK_ACCESS_SHARED, &g_curlInterface);
+  }
+
+  static void Unlock(curl_lock_data data)
+  {
+    DllLibCurlGlobal::ShareUnlock(nullptr, data, &g_curlInterface);
+  }
+
+  // tries to take the lock of the data type from another thread
+  static bool IsLocked(curl_lock_data data)
+  {
+    bool locked = false;
+    std::thread thread(
+        [data, &locked]()
+        {
+          CCriticalSection& lock = g_curlInterface.m_shareLocks[data];
+          locked = !lock.try_lock();
+          if (!locked)
+            lock.unlock();
+        });
+    thread.join();
+    return locked;
+  }
+};
+} // namespace XCURL
+
+using XCURL::TestDllLibCurlHelper;
+
+TEST(TestDllLibCurl, ShareLocks)
+{
+  ASSERT_NE(nullptr, g_curlInterface.GetShare());
+
+  // each data type has its own lock
+  TestDllLibCurlHelper::Lock(CURL_LOCK_DATA_DNS);
+  EXPECT_TRUE(TestDllLibCurlHelper::IsLocked(CURL_LOCK_DATA_DNS));
+  EXPECT_FALSE(TestDllLibCurlHelper::IsLocked(CURL_LOCK_DATA_SSL_SESSION));
+
+  TestDllLibCurlHelper::Lock(CURL_LOCK_DATA_SSL_SESSION);
+  EXPECT_TRUE(TestDllLibCurlHelper::IsLocked(CURL_LOCK_DATA_SSL_SESSION));
+
+  TestDllLibCurlHelper::Unlock(CURL_LOCK_DATA_DNS);
+  EXPECT_FALSE(TestDllLibCurlHelper::IsLocked(CURL_LOCK_DATA_DNS));
+  EXPECT_TRUE(TestDllLibCurlHelper::IsLocked(CURL_LOCK_DATA_SSL_SESSION));
+
+  TestDllLibCurlHelper::Unlock(CURL_LOCK_DATA_SSL_SESSION);
+  EXPECT_FALSE(TestDllLibCurlHelper::IsLocked(CURL_LOCK_DATA_SSL_SESSION));
+}
+
+TEST(TestDllLibCurl, ShareHandle)
+{
+  CURL_HANDLE* easy = g_curlInterface.easy_init();
+  ASSERT_NE(nullptr, easy);
+  EXPECT_EQ(CURLE_OK, g_curlInterface.easy_setopt(easy, CURLOPT_SHARE, g_curlInterface.GetShare()));
+  EXPECT_EQ(CURLE_OK, g_curlInterface.easy_setopt(easy, CURLOPT_SHARE, nullptr));
+  g_curlInterface.easy_cleanup(easy);
+}
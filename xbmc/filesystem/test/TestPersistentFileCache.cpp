@@ -0,0 +1,264 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "filesystem/Directory.h"
+#include "filesystem/File.h"
+#include "filesystem/PersistentFileCache.h"
+#include "filesystem/SpecialProtocol.h"
+#include "utils/URIUtils.h"
+
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace XFILE;
+
+namespace
+{
+constexpr int64_t FILE_SIZE = 3 * CPersistentFileCache::BLOCK_SIZE;
+
+class TestPersistentFileCache : public ::testing::Test
+{
+protected:
+  TestPersistentFileCache()
+  {
+    m_directory = URIUtils::AddFileToFolder(CSpecialProtocol::TranslatePath("special://temp/"),
+                                            "TestPersistentFileCache/");
+    for (int64_t i = 0; i < FILE_SIZE; ++i)
+      m_data.push_back(static_cast<char>(i * 7 % 251));
+  }
+
+  ~TestPersistentFileCache() override { CDirectory::RemoveRecursive(m_directory); }
+
+  std::unique_ptr<CPersistentFileCache> Create(const std::string& source,
+                                               int64_t modified = 1,
+                                               int64_t budget = 4 * FILE_SIZE)
+  {
+    auto cache = CPersistentFileCache::Create(m_directory, source, modified, FILE_SIZE, budget);
+    if (cache && cache->Open() != CACHE_RC_OK)
+      cache.reset();
+    return cache;
+  }
+
+  void Write(CCacheStrategy& cache, int64_t start, int64_t end)
+  {
+    cache.Reset(start);
+    ASSERT_EQ(start, cache.CachedDataEndPos());
+    ASSERT_EQ(end - start, cache.WriteToCache(m_data.data() + start, end - start));
+  }
+
+  std::string m_directory;
+  std::vector<char> m_data;
+};
+} // namespace
+
+TEST_F(TestPersistentFileCache, ReadWrite)
+{
+  auto cache = Create("source");
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(0, cache->CachedDataEndPosIfSeekTo(0));
+
+  const int64_t size = CPersistentFileCache::BLOCK_SIZE / 2;
+  ASSERT_EQ(size, cache->WriteToCache(m_data.data(), size));
+  EXPECT_EQ(size, cache->CachedDataEndPos());
+
+  std::vector<char> buffer(size);
+  EXPECT_EQ(size, cache->ReadFromCache(buffer.data(), buffer.size()));
+  EXPECT_EQ(0, memcmp(buffer.data(), m_data.data(), size));
+  EXPECT_EQ(CACHE_RC_WOULD_BLOCK, cache->ReadFromCache(buffer.data(), buffer.size()));
+
+  // positions behind the cached data need a reset of the writer
+  EXPECT_EQ(CACHE_RC_ERROR, cache->Seek(FILE_SIZE - 1));
+  EXPECT_EQ(100, cache->Seek(100));
+  EXPECT_TRUE(cache->Reset(FILE_SIZE - 1));
+}
+
+TEST_F(TestPersistentFileCache, Reopen)
+{
+  {
+    auto cache = Create("source");
+    ASSERT_NE(cache, nullptr);
+
+    // a source can only be written by one stream
+    EXPECT_EQ(nullptr,
+              CPersistentFileCache::Create(m_directory, "source", 1, FILE_SIZE, 4 * FILE_SIZE));
+
+    // the second block is incomplete and won't be recorded, the last one ends with the file
+    Write(*cache, 0, CPersistentFileCache::BLOCK_SIZE + 10);
+    Write(*cache, FILE_SIZE - 100, FILE_SIZE);
+    Write(*cache, 2 * CPersistentFileCache::BLOCK_SIZE - 1, FILE_SIZE - 100);
+    cache->Close();
+  }
+
+  auto cache = Create("source");
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(CPersistentFileCache::BLOCK_SIZE, cache->CachedDataEndPosIfSeekTo(0));
+  EXPECT_EQ(CPersistentFileCache::BLOCK_SIZE + 10,
+            cache->CachedDataEndPosIfSeekTo(CPersistentFileCache::BLOCK_SIZE + 10));
+  EXPECT_EQ(FILE_SIZE, cache->CachedDataEndPosIfSeekTo(2 * CPersistentFileCache::BLOCK_SIZE));
+
+  EXPECT_FALSE(cache->Reset(2 * CPersistentFileCache::BLOCK_SIZE));
+  std::vector<char> buffer(CPersistentFileCache::BLOCK_SIZE);
+  EXPECT_EQ(CPersistentFileCache::BLOCK_SIZE, cache->ReadFromCache(buffer.data(), buffer.size()));
+  EXPECT_EQ(0, memcmp(buffer.data(), m_data.data() + 2 * CPersistentFileCache::BLOCK_SIZE,
+                      buffer.size()));
+
+  // the writer continues behind the cached data
+  EXPECT_FALSE(cache->Reset(0));
+  Write(*cache, CPersistentFileCache::BLOCK_SIZE, CPersistentFileCache::BLOCK_SIZE + 10);
+  EXPECT_EQ(CPersistentFileCache::BLOCK_SIZE + 10, cache->CachedDataEndPos());
+}
+
+TEST_F(TestPersistentFileCache, ChangedSource)
+{
+  {
+    auto cache = Create("source");
+    ASSERT_NE(cache, nullptr);
+    Write(*cache, 0, FILE_SIZE);
+    cache->Close();
+  }
+
+  auto cache = Create("source", 2);
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(0, cache->CachedDataEndPosIfSeekTo(0));
+}
+
+TEST_F(TestPersistentFileCache, Budget)
+{
+  {
+    auto cache = Create("first", 1, FILE_SIZE);
+    ASSERT_NE(cache, nullptr);
+    Write(*cache, 0, FILE_SIZE);
+    cache->Close();
+  }
+  {
+    auto cache = Create("second", 1, FILE_SIZE);
+    ASSERT_NE(cache, nullptr);
+    Write(*cache, 0, CPersistentFileCache::BLOCK_SIZE);
+    cache->Close();
+  }
+
+  // the least recently used source is removed
+  auto cache = Create("first", 1, FILE_SIZE);
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(0, cache->CachedDataEndPosIfSeekTo(0));
+}
+
+TEST_F(TestPersistentFileCache, BudgetWhileWriting)
+{
+  constexpr int64_t BLOCK_SIZE = CPersistentFileCache::BLOCK_SIZE;
+  {
+    auto cache = Create("source", 1, 2 * BLOCK_SIZE);
+    ASSERT_NE(cache, nullptr);
+    Write(*cache, 0, 2 * BLOCK_SIZE);
+
+    // the reader hasn't passed a block yet, so the writer has to wait
+    EXPECT_EQ(0u, cache->GetMaxWriteSize(BLOCK_SIZE));
+    EXPECT_EQ(0, cache->WriteToCache(m_data.data() + 2 * BLOCK_SIZE, BLOCK_SIZE));
+
+    std::vector<char> buffer(BLOCK_SIZE + 1);
+    EXPECT_EQ(BLOCK_SIZE + 1, cache->ReadFromCache(buffer.data(), buffer.size()));
+    EXPECT_EQ(0, memcmp(buffer.data(), m_data.data(), buffer.size()));
+
+    // the first block is dropped for the last one
+    EXPECT_EQ(static_cast<size_t>(BLOCK_SIZE), cache->GetMaxWriteSize(BLOCK_SIZE));
+    EXPECT_EQ(BLOCK_SIZE, cache->WriteToCache(m_data.data() + 2 * BLOCK_SIZE, BLOCK_SIZE));
+    EXPECT_EQ(0, cache->CachedDataEndPosIfSeekTo(0));
+    EXPECT_EQ(FILE_SIZE, cache->CachedDataEndPos());
+
+    buffer.resize(FILE_SIZE - BLOCK_SIZE - 1);
+    EXPECT_EQ(FILE_SIZE - BLOCK_SIZE - 1, cache->ReadFromCache(buffer.data(), buffer.size()));
+    EXPECT_EQ(0, memcmp(buffer.data(), m_data.data() + BLOCK_SIZE + 1, buffer.size()));
+    cache->Close();
+  }
+
+  CFileItemList items;
+  ASSERT_TRUE(CDirectory::GetDirectory(m_directory, items, ".cache", DIR_FLAG_BYPASS_CACHE));
+  ASSERT_EQ(1, items.Size());
+  EXPECT_EQ(2 * BLOCK_SIZE, items[0]->m_dwSize);
+
+  auto cache = Create("source", 1, 2 * BLOCK_SIZE);
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(0, cache->CachedDataEndPosIfSeekTo(0));
+  EXPECT_EQ(FILE_SIZE, cache->CachedDataEndPosIfSeekTo(BLOCK_SIZE));
+}
+
+TEST_F(TestPersistentFileCache, Discard)
+{
+  {
+    auto cache = Create("source");
+    ASSERT_NE(cache, nullptr);
+    Write(*cache, 0, FILE_SIZE);
+    cache->Close();
+  }
+
+  auto cache = Create("source");
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(FILE_SIZE, cache->CachedDataEndPosIfSeekTo(0));
+  cache->Discard();
+  EXPECT_EQ(0, cache->CachedDataEndPosIfSeekTo(0));
+  EXPECT_FALSE(cache->IsCachedPosition(FILE_SIZE - 1));
+
+  // the writer starts over at the beginning of the source
+  Write(*cache, 0, CPersistentFileCache::BLOCK_SIZE);
+  std::vector<char> buffer(CPersistentFileCache::BLOCK_SIZE);
+  EXPECT_EQ(CPersistentFileCache::BLOCK_SIZE, cache->ReadFromCache(buffer.data(), buffer.size()));
+  EXPECT_EQ(0, memcmp(buffer.data(), m_data.data(), buffer.size()));
+  cache.reset();
+
+  cache = Create("source");
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(CPersistentFileCache::BLOCK_SIZE, cache->CachedDataEndPosIfSeekTo(0));
+  EXPECT_EQ(CPersistentFileCache::BLOCK_SIZE,
+            cache->CachedDataEndPosIfSeekTo(CPersistentFileCache::BLOCK_SIZE));
+}
+
+TEST_F(TestPersistentFileCache, NotClosed)
+{
+  constexpr int64_t BLOCK_SIZE = CPersistentFileCache::BLOCK_SIZE;
+  {
+    auto cache = Create("source", 1, 2 * BLOCK_SIZE);
+    ASSERT_NE(cache, nullptr);
+    Write(*cache, 0, 2 * BLOCK_SIZE);
+    cache->Close();
+  }
+
+  CFileItemList items;
+  ASSERT_TRUE(CDirectory::GetDirectory(m_directory, items, "", DIR_FLAG_BYPASS_CACHE));
+  ASSERT_EQ(2, items.Size());
+  {
+    auto cache = Create("source", 1, 2 * BLOCK_SIZE);
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(2 * BLOCK_SIZE, cache->CachedDataEndPosIfSeekTo(0));
+
+    // the slot of the first block now holds the last one
+    std::vector<char> buffer(BLOCK_SIZE + 1);
+    EXPECT_EQ(BLOCK_SIZE + 1, cache->ReadFromCache(buffer.data(), buffer.size()));
+    ASSERT_EQ(BLOCK_SIZE, cache->WriteToCache(m_data.data() + 2 * BLOCK_SIZE, BLOCK_SIZE));
+
+    // the files as they would be left behind by a crash
+    for (const auto& item : items)
+      ASSERT_TRUE(CFile::Copy(item->GetPath(), item->GetPath() + ".crash"));
+  }
+  for (const auto& item : items)
+  {
+    ASSERT_TRUE(CFile::Delete(item->GetPath()));
+    ASSERT_TRUE(CFile::Rename(item->GetPath() + ".crash", item->GetPath()));
+  }
+
+  auto cache = Create("source", 1, 2 * BLOCK_SIZE);
+  ASSERT_NE(cache, nullptr);
+  EXPECT_EQ(0, cache->CachedDataEndPosIfSeekTo(0));
+  EXPECT_FALSE(cache->IsCachedPosition(BLOCK_SIZE));
+  EXPECT_FALSE(cache->IsCachedPosition(2 * BLOCK_SIZE));
+}
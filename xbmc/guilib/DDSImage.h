@@ -26,7 +26,12 @@ public:
   unsigned int GetSize() const;
   unsigned char *GetData() const;
 
+  /*! \brief whether the image uses its alpha channel, only meaningful for uncompressed images */
+  bool HasAlpha() const;
+  void SetAlpha(bool hasAlpha);
+
   bool ReadFile(const std::string &file);
+  bool WriteFile(const std::string& file) const;
 
 private:
   void Allocate(unsigned int width, unsigned int height, XB_FMT format);
@@ -120,6 +120,7 @@ void CGUIControl::DynamicResourceAlloc(bool bOnOff)
 // 3. reset the animation transform
 void CGUIControl::DoProcess(unsigned int currentTime, CDirtyRegionList &dirtyregions)
 {
+  GUIPROFILER_FRAME_SCOPE(this, "process");
   CRect dirtyRegion = m_renderRegion;
 
   bool changed = (m_controlDirtyState & DIRTY_STATE_CONTROL) != 0 || (m_bInvalidated && IsVisible());
@@ -186,6 +187,7 @@ void CGUIControl::DoRender()
 
   if (IsVisible() && !m_isCulled)
   {
+    GUIPROFILER_FRAME_SCOPE(this, "render");
     bool hasStereo =
         m_stereo != 0.0f &&
         CServiceBroker::GetWinSystem()->GetGfxContext().GetStereoMode() !=
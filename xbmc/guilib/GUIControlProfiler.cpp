@@ -78,74 +78,7 @@ void CGUIControlProfilerItem::SaveToXML(TiXmlElement *parent)
   TiXmlElement *xmlControl = new TiXmlElement("control");
   parent->LinkEndChild(xmlControl);
 
-  const char *lpszType = NULL;
-  switch (m_ControlType)
-  {
-  case CGUIControl::GUICONTROL_BUTTON:
-    lpszType = "button"; break;
-  case CGUIControl::GUICONTROL_FADELABEL:
-    lpszType = "fadelabel"; break;
-  case CGUIControl::GUICONTROL_IMAGE:
-  case CGUIControl::GUICONTROL_BORDEREDIMAGE:
-    lpszType = "image"; break;
-  case CGUIControl::GUICONTROL_LABEL:
-    lpszType = "label"; break;
-  case CGUIControl::GUICONTROL_LISTGROUP:
-    lpszType = "group"; break;
-  case CGUIControl::GUICONTROL_PROGRESS:
-    lpszType = "progress"; break;
-  case CGUIControl::GUICONTROL_RADIO:
-    lpszType = "radiobutton"; break;
-  case CGUIControl::GUICONTROL_RSS:
-    lpszType = "rss"; break;
-  case CGUIControl::GUICONTROL_SLIDER:
-    lpszType = "slider"; break;
-  case CGUIControl::GUICONTROL_SETTINGS_SLIDER:
-    lpszType = "sliderex"; break;
-  case CGUIControl::GUICONTROL_SPIN:
-    lpszType = "spincontrol"; break;
-  case CGUIControl::GUICONTROL_SPINEX:
-    lpszType = "spincontrolex"; break;
-  case CGUIControl::GUICONTROL_TEXTBOX:
-    lpszType = "textbox"; break;
-  case CGUIControl::GUICONTROL_TOGGLEBUTTON:
-    lpszType = "togglebutton"; break;
-  case CGUIControl::GUICONTROL_VIDEO:
-    lpszType = "videowindow"; break;
-  case CGUIControl::GUICONTROL_MOVER:
-    lpszType = "mover"; break;
-  case CGUIControl::GUICONTROL_RESIZE:
-    lpszType = "resize"; break;
-  case CGUIControl::GUICONTROL_EDIT:
-    lpszType = "edit"; break;
-  case CGUIControl::GUICONTROL_VISUALISATION:
-    lpszType = "visualisation"; break;
-  case CGUIControl::GUICONTROL_MULTI_IMAGE:
-    lpszType = "multiimage"; break;
-  case CGUIControl::GUICONTROL_GROUP:
-    lpszType = "group"; break;
-  case CGUIControl::GUICONTROL_GROUPLIST:
-    lpszType = "grouplist"; break;
-  case CGUIControl::GUICONTROL_SCROLLBAR:
-    lpszType = "scrollbar"; break;
-  case CGUIControl::GUICONTROL_LISTLABEL:
-    lpszType = "label"; break;
-  case CGUIControl::GUICONTAINER_LIST:
-    lpszType = "list"; break;
-  case CGUIControl::GUICONTAINER_WRAPLIST:
-    lpszType = "wraplist"; break;
-  case CGUIControl::GUICONTAINER_FIXEDLIST:
-    lpszType = "fixedlist"; break;
-  case CGUIControl::GUICONTAINER_PANEL:
-    lpszType = "panel"; break;
-  case CGUIControl::GUICONTROL_COLORBUTTON:
-    lpszType = "colorbutton";
-    break;
-  //case CGUIControl::GUICONTROL_UNKNOWN:
-  default:
-    break;
-  }
-
+  const char* lpszType = CGUIControlProfiler::GetControlTypeName(m_ControlType);
   if (lpszType)
     xmlControl->SetAttribute("type", lpszType);
   if (m_controlID != 0)
@@ -229,6 +162,75 @@ CGUIControlProfiler::CGUIControlProfiler(void)
   m_fPerfScale = 100000.0f / CurrentHostFrequency();
 }
 
+const char* CGUIControlProfiler::GetControlTypeName(CGUIControl::GUICONTROLTYPES type)
+{
+  switch (type)
+  {
+  case CGUIControl::GUICONTROL_BUTTON:
+    return "button";
+  case CGUIControl::GUICONTROL_FADELABEL:
+    return "fadelabel";
+  case CGUIControl::GUICONTROL_IMAGE:
+  case CGUIControl::GUICONTROL_BORDEREDIMAGE:
+    return "image";
+  case CGUIControl::GUICONTROL_LABEL:
+    return "label";
+  case CGUIControl::GUICONTROL_LISTGROUP:
+    return "group";
+  case CGUIControl::GUICONTROL_PROGRESS:
+    return "progress";
+  case CGUIControl::GUICONTROL_RADIO:
+    return "radiobutton";
+  case CGUIControl::GUICONTROL_RSS:
+    return "rss";
+  case CGUIControl::GUICONTROL_SLIDER:
+    return "slider";
+  case CGUIControl::GUICONTROL_SETTINGS_SLIDER:
+    return "sliderex";
+  case CGUIControl::GUICONTROL_SPIN:
+    return "spincontrol";
+  case CGUIControl::GUICONTROL_SPINEX:
+    return "spincontrolex";
+  case CGUIControl::GUICONTROL_TEXTBOX:
+    return "textbox";
+  case CGUIControl::GUICONTROL_TOGGLEBUTTON:
+    return "togglebutton";
+  case CGUIControl::GUICONTROL_VIDEO:
+    return "videowindow";
+  case CGUIControl::GUICONTROL_MOVER:
+    return "mover";
+  case CGUIControl::GUICONTROL_RESIZE:
+    return "resize";
+  case CGUIControl::GUICONTROL_EDIT:
+    return "edit";
+  case CGUIControl::GUICONTROL_VISUALISATION:
+    return "visualisation";
+  case CGUIControl::GUICONTROL_MULTI_IMAGE:
+    return "multiimage";
+  case CGUIControl::GUICONTROL_GROUP:
+    return "group";
+  case CGUIControl::GUICONTROL_GROUPLIST:
+    return "grouplist";
+  case CGUIControl::GUICONTROL_SCROLLBAR:
+    return "scrollbar";
+  case CGUIControl::GUICONTROL_LISTLABEL:
+    return "label";
+  case CGUIControl::GUICONTAINER_LIST:
+    return "list";
+  case CGUIControl::GUICONTAINER_WRAPLIST:
+    return "wraplist";
+  case CGUIControl::GUICONTAINER_FIXEDLIST:
+    return "fixedlist";
+  case CGUIControl::GUICONTAINER_PANEL:
+    return "panel";
+  case CGUIControl::GUICONTROL_COLORBUTTON:
+    return "colorbutton";
+  //case CGUIControl::GUICONTROL_UNKNOWN:
+  default:
+    return nullptr;
+  }
+}
+
 CGUIControlProfiler &CGUIControlProfiler::Instance(void)
 {
   static CGUIControlProfiler _instance;
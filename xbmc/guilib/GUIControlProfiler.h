@@ -9,6 +9,7 @@
 #pragma once
 
 #include "GUIControl.h"
+#include "GUIFrameProfiler.h"
 
 #include <vector>
 
@@ -64,6 +65,9 @@ public:
   bool SaveResults(void);
   unsigned int GetTotalTime(void) const { return m_ItemHead.GetTotalTime(); }
 
+  /*! \brief Get the name of the control type as used in skins, nullptr if unknown */
+  static const char* GetControlTypeName(CGUIControl::GUICONTROLTYPES type);
+
   float m_fPerfScale;
 private:
   CGUIControlProfiler(void);
@@ -85,4 +89,9 @@ private:
 #define GUIPROFILER_VISIBILITY_END(x) { if (CGUIControlProfiler::IsRunning()) CGUIControlProfiler::Instance().EndVisibility(x); }
 #define GUIPROFILER_RENDER_BEGIN(x) { if (CGUIControlProfiler::IsRunning()) CGUIControlProfiler::Instance().BeginRender(x); }
 #define GUIPROFILER_RENDER_END(x) { if (CGUIControlProfiler::IsRunning()) CGUIControlProfiler::Instance().EndRender(x); }
-
+#define GUIPROFILER_FRAME_SCOPE(x, category) \
+  const bool guiFrameProfilerControls = CGUIFrameProfiler::IsProfilingControls(); \
+  CGUIFrameProfilerScope guiFrameProfilerScope( \
+      guiFrameProfilerControls ? CGUIControlProfiler::GetControlTypeName((x)->GetControlType()) \
+                               : nullptr, \
+      category, guiFrameProfilerControls, (x)->GetID())
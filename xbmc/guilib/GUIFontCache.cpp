@@ -7,6 +7,7 @@
  */
 
 #include "GUIFontTTF.h"
+#include "GUIFrameProfiler.h"
 #include "windowing/GraphicContext.h"
 
 #include <stdint.h>
@@ -167,6 +168,7 @@ Value& CGUIFontCacheImpl<Position, Value>::Lookup(
   if (i == m_list.hashMap.end())
   {
     // Cache miss
+    GUIFRAMEPROFILER_COUNT(FONT_CACHE_MISSES);
     dirtyCache = true;
     std::unique_ptr<CGUIFontCacheEntry<Position, Value>> entry;
 
@@ -193,6 +195,8 @@ Value& CGUIFontCacheImpl<Position, Value>::Lookup(
   else
   {
     // Cache hit
+    GUIFRAMEPROFILER_COUNT(FONT_CACHE_HITS);
+
     // Update the translation arguments so that they hold the offset to apply
     // to the cached values (but only in the dynamic case)
     pos.UpdateWithOffsets(i->second->m_key.m_pos, scrolling);
@@ -21,6 +21,7 @@
 #include "windowing/GraphicContext.h"
 #include "windowing/WinSystem.h"
 
+#include <algorithm>
 #include <math.h>
 #include <memory>
 #include <queue>
@@ -59,6 +60,7 @@ constexpr int CHAR_CHUNK = 64; // 64 chars allocated at a time (2048 bytes)
 constexpr int GLYPH_STRENGTH_BOLD = 24;
 constexpr int GLYPH_STRENGTH_LIGHT = -48;
 constexpr int TAB_SPACE_LENGTH = 4;
+constexpr size_t SHAPE_CACHE_SIZE = 512; // number of shaped texts cached per font
 
 // \brief Check for conflicting alignments
 void ValidateAlignments(uint32_t& aligns)
@@ -243,6 +245,7 @@ void CGUIFontTTF::Clear()
   m_posY = 0;
   m_nestedBeginCount = 0;
 
+  ClearShapeCache();
   if (m_hbFont)
     hb_font_destroy(m_hbFont);
   m_hbFont = nullptr;
@@ -450,7 +453,8 @@ void CGUIFontTTF::DrawTextInternal(CGraphicContext& context,
     //! by add validating alignments from each parent caller component
     ValidateAlignments(alignment);
 
-    const std::vector<Glyph> glyphs = GetHarfBuzzShapedGlyphs(text);
+    const ShapedGlyphs shapedGlyphs = GetHarfBuzzShapedGlyphs(text);
+    const std::vector<Glyph>& glyphs = *shapedGlyphs;
     // save the origin, which is scaled separately
 #if not defined(HAS_DX)
     // the origin is now at [0,0], and not at "random" locations anymore. positioning is done in the vertex shader.
@@ -745,8 +749,7 @@ void CGUIFontTTF::DrawTextInternal(CGraphicContext& context,
 
 float CGUIFontTTF::GetTextWidthInternal(const vecText& text)
 {
-  const std::vector<Glyph> glyphs = GetHarfBuzzShapedGlyphs(text);
-  return GetTextWidthInternal(text, glyphs);
+  return GetTextWidthInternal(text, *GetHarfBuzzShapedGlyphs(text));
 }
 
 // this routine assumes a single line (i.e. it was called from GUITextLayout)
@@ -811,10 +814,54 @@ unsigned int CGUIFontTTF::GetMaxFontHeight() const
   return m_maxFontHeight + SPACING_BETWEEN_CHARACTERS_IN_TEXTURE;
 }
 
-std::vector<CGUIFontTTF::Glyph> CGUIFontTTF::GetHarfBuzzShapedGlyphs(const vecText& text)
+size_t CGUIFontTTF::ShapeCacheHash::operator()(const vecText& characters) const
+{
+  // FNV-1a
+  size_t hash = 2166136261u;
+  for (const character_t character : characters)
+  {
+    hash ^= character;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+CGUIFontTTF::ShapedGlyphs CGUIFontTTF::GetHarfBuzzShapedGlyphs(const vecText& text)
+{
+  // style and color are kept in the upper bits, they don't change the shaping
+  m_shapeKey.resize(text.size());
+  std::transform(text.begin(), text.end(), m_shapeKey.begin(),
+                 [](character_t character) { return character & 0xffff; });
+
+  const auto it = m_shapeCache.find(m_shapeKey);
+  if (it != m_shapeCache.end())
+  {
+    m_shapeCacheOrder.splice(m_shapeCacheOrder.end(), m_shapeCacheOrder, it->second.m_lastUsed);
+    return it->second.m_glyphs;
+  }
+
+  if (m_shapeCache.size() >= SHAPE_CACHE_SIZE)
+  {
+    m_shapeCache.erase(m_shapeCache.find(*m_shapeCacheOrder.front()));
+    m_shapeCacheOrder.pop_front();
+  }
+
+  ShapedGlyphs glyphs = std::make_shared<const std::vector<Glyph>>(ShapeText(m_shapeKey));
+  const auto inserted = m_shapeCache.emplace(m_shapeKey, ShapeCacheEntry{glyphs, {}}).first;
+  inserted->second.m_lastUsed = m_shapeCacheOrder.insert(m_shapeCacheOrder.end(), &inserted->first);
+  return glyphs;
+}
+
+void CGUIFontTTF::ClearShapeCache()
+{
+  m_shapeCache.clear();
+  m_shapeCacheOrder.clear();
+}
+
+std::vector<CGUIFontTTF::Glyph> CGUIFontTTF::ShapeText(const vecText& characters) const
 {
   std::vector<Glyph> glyphs;
-  if (text.empty())
+  if (characters.empty())
   {
     return glyphs;
   }
@@ -826,10 +873,10 @@ std::vector<CGUIFontTTF::Glyph> CGUIFontTTF::GetHarfBuzzShapedGlyphs(const vecTe
   int lastScriptIndex = -1;
   int lastSetIndex = -1;
 
-  scripts.reserve(text.size());
-  for (const auto& character : text)
+  scripts.reserve(characters.size());
+  for (const auto& character : characters)
   {
-    scripts.emplace_back(hb_unicode_script(ufuncs, static_cast<wchar_t>(0xffff & character)));
+    scripts.emplace_back(hb_unicode_script(ufuncs, static_cast<wchar_t>(character)));
   }
 
   // HB_SCRIPT_COMMON or HB_SCRIPT_INHERITED should be replaced with previous script
@@ -886,7 +933,7 @@ std::vector<CGUIFontTTF::Glyph> CGUIFontTTF::GetHarfBuzzShapedGlyphs(const vecTe
 
     for (unsigned int j = run.m_startOffset; j < run.m_endOffset; j++)
     {
-      hb_buffer_add(run.m_buffer, static_cast<wchar_t>(0xffff & text[j]), j);
+      hb_buffer_add(run.m_buffer, static_cast<wchar_t>(characters[j]), j);
     }
 
     hb_buffer_set_content_type(run.m_buffer, HB_BUFFER_CONTENT_TYPE_UNICODE);
@@ -12,9 +12,11 @@
 #include "utils/ColorUtils.h"
 #include "utils/Geometry.h"
 
+#include <list>
 #include <memory>
 #include <stdint.h>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <ft2build.h>
@@ -147,7 +149,15 @@ protected:
   void AddReference();
   void RemoveReference();
 
-  std::vector<Glyph> GetHarfBuzzShapedGlyphs(const vecText& text);
+  using ShapedGlyphs = std::shared_ptr<const std::vector<Glyph>>;
+
+  /*!
+   \brief Shape the text with HarfBuzz
+   \return the glyphs of the text, the results are cached as they only depend on the characters
+   */
+  ShapedGlyphs GetHarfBuzzShapedGlyphs(const vecText& text);
+  std::vector<Glyph> ShapeText(const vecText& characters) const;
+  void ClearShapeCache();
 
   float GetTextWidthInternal(const vecText& text);
   float GetTextWidthInternal(const vecText& text, const std::vector<Glyph>& glyph);
@@ -271,6 +281,20 @@ protected:
   std::vector<uint8_t>
       m_fontFileInMemory; // used only in some cases, see CFreeTypeLibrary::GetFont()
 
+  struct ShapeCacheHash
+  {
+    size_t operator()(const vecText& characters) const;
+  };
+  struct ShapeCacheEntry
+  {
+    ShapedGlyphs m_glyphs;
+    std::list<const vecText*>::iterator m_lastUsed;
+  };
+  // shaped texts by their characters without style and color, the least recently used first
+  std::unordered_map<vecText, ShapeCacheEntry, ShapeCacheHash> m_shapeCache;
+  std::list<const vecText*> m_shapeCacheOrder;
+  vecText m_shapeKey; // reused for the lookups
+
   CGUIFontCache<CGUIFontCacheStaticPosition, CGUIFontCacheStaticValue> m_staticCache;
   CGUIFontCache<CGUIFontCacheDynamicPosition, CGUIFontCacheDynamicValue> m_dynamicCache;
 
@@ -0,0 +1,179 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIFrameProfiler.h"
+
+#include "utils/TimeUtils.h"
+#include "utils/Variant.h"
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+
+namespace
+{
+constexpr const char* COUNTER_NAMES[] = {"infobool updates", "font cache hits",
+                                         "font cache misses", "texture uploads",
+                                         "texture uploads deferred"};
+static_assert(std::size(COUNTER_NAMES) ==
+              static_cast<size_t>(CGUIFrameProfiler::Counter::COUNT));
+} // namespace
+
+std::atomic<bool> CGUIFrameProfiler::m_running{false};
+std::atomic<bool> CGUIFrameProfiler::m_profileControls{false};
+std::array<std::atomic<unsigned int>, static_cast<size_t>(CGUIFrameProfiler::Counter::COUNT)>
+    CGUIFrameProfiler::m_counters{};
+
+CGUIFrameProfiler& CGUIFrameProfiler::GetInstance()
+{
+  static CGUIFrameProfiler instance;
+  return instance;
+}
+
+void CGUIFrameProfiler::Start(unsigned int maxFrames, bool controls)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  m_maxFrames = std::max(maxFrames, 1u);
+  m_frames.clear();
+  m_threads.clear();
+  m_frame = CFrame();
+  m_startTime = m_frame.start = CurrentHostCounter();
+  for (auto& counter : m_counters)
+    counter = 0;
+
+  m_profileControls = controls;
+  m_running = true;
+}
+
+void CGUIFrameProfiler::Stop()
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  m_running = false;
+  m_profileControls = false;
+}
+
+void CGUIFrameProfiler::NewFrame()
+{
+  if (!IsRunning())
+    return;
+
+  const int64_t now = CurrentHostCounter();
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  if (!m_running)
+    return;
+
+  for (size_t i = 0; i < m_counters.size(); ++i)
+    m_frame.counters[i] = m_counters[i].exchange(0, std::memory_order_relaxed);
+  m_frame.end = now;
+
+  // reuse the memory of the oldest frame, the number of events is about the same in every frame
+  CFrame next;
+  if (m_frames.size() >= m_maxFrames)
+  {
+    next = std::move(m_frames.front());
+    m_frames.pop_front();
+    next.events.clear();
+  }
+  next.start = now;
+  m_frames.emplace_back(std::move(m_frame));
+  m_frame = std::move(next);
+}
+
+void CGUIFrameProfiler::AddEvent(
+    const char* name, const char* category, int64_t start, int64_t end, int id)
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+  if (!m_running)
+    return;
+
+  m_frame.events.push_back({name, category, start, end, id, GetThread(std::this_thread::get_id())});
+}
+
+int CGUIFrameProfiler::GetThread(std::thread::id id)
+{
+  // threads are numbered in the order of their first section, the render thread usually is first
+  const auto it = m_threads.find(id);
+  if (it != m_threads.end())
+    return it->second;
+  const int thread = static_cast<int>(m_threads.size()) + 1;
+  m_threads.emplace(id, thread);
+  return thread;
+}
+
+double CGUIFrameProfiler::ToMicroseconds(int64_t time) const
+{
+  return static_cast<double>(time - m_startTime) * 1000000.0 /
+         static_cast<double>(CurrentHostFrequency());
+}
+
+void CGUIFrameProfiler::GetTrace(CVariant& trace, unsigned int maxFrames) const
+{
+  std::unique_lock<CCriticalSection> lock(m_critSection);
+
+  trace = CVariant(CVariant::VariantTypeObject);
+  trace["displayTimeUnit"] = "ms";
+  trace["otherData"]["running"] = m_running.load();
+  trace["otherData"]["frames"] = static_cast<uint64_t>(m_frames.size());
+
+  CVariant events(CVariant::VariantTypeArray);
+  CVariant metadata(CVariant::VariantTypeObject);
+  metadata["name"] = "process_name";
+  metadata["ph"] = "M";
+  metadata["pid"] = 1;
+  metadata["args"]["name"] = "GUI";
+  events.push_back(std::move(metadata));
+
+  size_t first = 0;
+  if (maxFrames > 0 && m_frames.size() > maxFrames)
+    first = m_frames.size() - maxFrames;
+
+  for (size_t i = first; i < m_frames.size(); ++i)
+  {
+    const CFrame& frame = m_frames[i];
+
+    CVariant frameEvent(CVariant::VariantTypeObject);
+    frameEvent["name"] = "Frame";
+    frameEvent["cat"] = "frame";
+    frameEvent["ph"] = "X";
+    frameEvent["ts"] = ToMicroseconds(frame.start);
+    frameEvent["dur"] = ToMicroseconds(frame.end) - ToMicroseconds(frame.start);
+    frameEvent["pid"] = 1;
+    frameEvent["tid"] = 1;
+    events.push_back(std::move(frameEvent));
+
+    CVariant counters(CVariant::VariantTypeObject);
+    counters["name"] = "Counters";
+    counters["ph"] = "C";
+    counters["ts"] = ToMicroseconds(frame.start);
+    counters["pid"] = 1;
+    for (size_t counter = 0; counter < frame.counters.size(); ++counter)
+      counters["args"][COUNTER_NAMES[counter]] = frame.counters[counter];
+    events.push_back(std::move(counters));
+
+    for (const CEvent& section : frame.events)
+    {
+      CVariant event(CVariant::VariantTypeObject);
+      event["name"] = section.name ? section.name : "control";
+      event["cat"] = section.category;
+      event["ph"] = "X";
+      event["ts"] = ToMicroseconds(section.start);
+      event["dur"] = ToMicroseconds(section.end) - ToMicroseconds(section.start);
+      event["pid"] = 1;
+      event["tid"] = section.thread;
+      if (section.id != 0)
+        event["args"]["id"] = section.id;
+      events.push_back(std::move(event));
+    }
+  }
+  trace["traceEvents"] = std::move(events);
+}
+
+int64_t CGUIFrameProfilerScope::Now()
+{
+  return CurrentHostCounter();
+}
@@ -0,0 +1,158 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/CriticalSection.h"
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <map>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+class CVariant;
+
+/*!
+ \brief Records a timeline of the GUI work done in every frame
+
+ While running, the profiler keeps the last few hundred frames. Each frame holds the timed
+ sections of the frame (window processing and rendering, dirty region solving, texture uploads and
+ optionally every control) and a number of counters (info bool updates, font cache hits and
+ misses, texture uploads and deferred uploads). The frames can be exported in the Chrome trace
+ event format, which can be loaded into chrome://tracing or Perfetto.
+
+ When the profiler isn't running the instrumentation costs a single relaxed atomic load.
+ */
+class CGUIFrameProfiler
+{
+public:
+  enum class Counter
+  {
+    INFOBOOL_UPDATES,
+    FONT_CACHE_HITS,
+    FONT_CACHE_MISSES,
+    TEXTURE_UPLOADS,
+    TEXTURE_UPLOADS_DEFERRED,
+    COUNT
+  };
+
+  static constexpr unsigned int DEFAULT_MAX_FRAMES = 300;
+
+  static CGUIFrameProfiler& GetInstance();
+
+  static bool IsRunning() { return m_running.load(std::memory_order_relaxed); }
+  static bool IsProfilingControls()
+  {
+    return IsRunning() && m_profileControls.load(std::memory_order_relaxed);
+  }
+
+  /*!
+   \brief Start recording, drops the frames recorded before
+   \param maxFrames number of frames to keep, older frames are dropped
+   \param controls record the processing and rendering of every control as well
+   */
+  void Start(unsigned int maxFrames = DEFAULT_MAX_FRAMES, bool controls = false);
+  void Stop();
+
+  /*! \brief Finish the current frame and start the next one */
+  void NewFrame();
+
+  /*!
+   \brief Add a timed section to the current frame
+   \param name name of the section, has to be a string literal or nullptr for an unknown control
+   \param category category of the section, has to be a string literal
+   \param start start of the section as returned by CurrentHostCounter()
+   \param end end of the section as returned by CurrentHostCounter()
+   \param id optional id, e.g. of the control
+   */
+  void AddEvent(const char* name, const char* category, int64_t start, int64_t end, int id = 0);
+
+  static void Increment(Counter counter)
+  {
+    if (IsRunning())
+      m_counters[static_cast<size_t>(counter)].fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /*!
+   \brief Export the recorded frames in the Chrome trace event format
+   \param trace the object to fill with the trace events
+   \param maxFrames maximum number of frames to export, the most recent ones are used
+   */
+  void GetTrace(CVariant& trace, unsigned int maxFrames = 0) const;
+
+private:
+  CGUIFrameProfiler() = default;
+  CGUIFrameProfiler(const CGUIFrameProfiler&) = delete;
+  CGUIFrameProfiler& operator=(const CGUIFrameProfiler&) = delete;
+
+  struct CEvent
+  {
+    const char* name;
+    const char* category;
+    int64_t start;
+    int64_t end;
+    int id;
+    int thread;
+  };
+
+  struct CFrame
+  {
+    int64_t start = 0;
+    int64_t end = 0;
+    std::vector<CEvent> events;
+    std::array<unsigned int, static_cast<size_t>(Counter::COUNT)> counters{};
+  };
+
+  int GetThread(std::thread::id id);
+  double ToMicroseconds(int64_t time) const;
+
+  static std::atomic<bool> m_running;
+  static std::atomic<bool> m_profileControls;
+  static std::array<std::atomic<unsigned int>, static_cast<size_t>(Counter::COUNT)> m_counters;
+
+  mutable CCriticalSection m_critSection;
+  unsigned int m_maxFrames = DEFAULT_MAX_FRAMES;
+  int64_t m_startTime = 0;
+  CFrame m_frame; //!< the frame being recorded
+  std::deque<CFrame> m_frames;
+  std::map<std::thread::id, int> m_threads;
+};
+
+/*! \brief Adds the lifetime of the object as a section of the current frame */
+class CGUIFrameProfilerScope
+{
+public:
+  CGUIFrameProfilerScope(const char* name, const char* category, bool enabled, int id = 0)
+    : m_name(name), m_category(category), m_id(id), m_start(enabled ? Now() : 0)
+  {
+  }
+  ~CGUIFrameProfilerScope()
+  {
+    if (m_start)
+      CGUIFrameProfiler::GetInstance().AddEvent(m_name, m_category, m_start, Now(), m_id);
+  }
+
+private:
+  CGUIFrameProfilerScope(const CGUIFrameProfilerScope&) = delete;
+  CGUIFrameProfilerScope& operator=(const CGUIFrameProfilerScope&) = delete;
+
+  static int64_t Now();
+
+  const char* m_name;
+  const char* m_category;
+  int m_id;
+  int64_t m_start;
+};
+
+#define GUIFRAMEPROFILER_SCOPE(name, category) \
+  CGUIFrameProfilerScope guiFrameProfilerScope(name, category, CGUIFrameProfiler::IsRunning())
+#define GUIFRAMEPROFILER_COUNT(counter) \
+  CGUIFrameProfiler::Increment(CGUIFrameProfiler::Counter::counter)
@@ -10,6 +10,7 @@
 
 #include "GUIAudioManager.h"
 #include "GUIDialog.h"
+#include "GUIFrameProfiler.h"
 #include "GUIInfoManager.h"
 #include "GUIPassword.h"
 #include "GUITexture.h"
@@ -1220,6 +1221,10 @@ void CGUIWindowManager::Process(unsigned int currentTime)
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
   std::unique_lock<CCriticalSection> lock(CServiceBroker::GetWinSystem()->GetGfxContext());
 
+  // processing the windows is the first step of every frame
+  CGUIFrameProfiler::GetInstance().NewFrame();
+  GUIFRAMEPROFILER_SCOPE("Process", "gui");
+
   m_dirtyregions.clear();
 
   CGUIWindow* pWindow = GetWindow(GetActiveWindow());
@@ -1355,8 +1360,13 @@ bool CGUIWindowManager::Render()
 {
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
   CSingleExit lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+  GUIFRAMEPROFILER_SCOPE("Render", "gui");
 
-  CDirtyRegionList dirtyRegions = m_tracker.GetDirtyRegions();
+  CDirtyRegionList dirtyRegions;
+  {
+    GUIFRAMEPROFILER_SCOPE("SolveDirtyRegions", "gui");
+    dirtyRegions = m_tracker.GetDirtyRegions();
+  }
 
   bool hasRendered = false;
   // If we visualize the regions we will always render the entire viewport
@@ -1427,6 +1437,7 @@ void CGUIWindowManager::FrameMove()
 {
   assert(CServiceBroker::GetAppMessenger()->IsProcessThread());
   std::unique_lock<CCriticalSection> lock(CServiceBroker::GetWinSystem()->GetGfxContext());
+  GUIFRAMEPROFILER_SCOPE("FrameMove", "gui");
 
   if(m_iNested == 0)
   {
@@ -154,6 +154,8 @@ bool CTexture::LoadFromFileInternal(const std::string& texturePath,
     if (image.ReadFile(texturePath))
     {
       Update(image.GetWidth(), image.GetHeight(), 0, image.GetFormat(), image.GetData(), false);
+      if (image.GetFormat() == XB_FMT_A8R8G8B8)
+        SetAlpha(image.HasAlpha());
       return true;
     }
     return false;
@@ -8,6 +8,7 @@
 
 #include "TextureDX.h"
 
+#include "guilib/GUIFrameProfiler.h"
 #include "utils/MemUtils.h"
 #include "utils/log.h"
 
@@ -75,6 +76,8 @@ void CDXTexture::LoadToGPU()
     // nothing to load - probably same image (no change)
     return;
   }
+  GUIFRAMEPROFILER_SCOPE("LoadToGPU", "texture");
+  GUIFRAMEPROFILER_COUNT(TEXTURE_UPLOADS);
 
   bool needUpdate = true;
   D3D11_USAGE usage = D3D11_USAGE_DEFAULT;
@@ -9,6 +9,7 @@
 #include "TextureGL.h"
 
 #include "ServiceBroker.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/TextureFormats.h"
 #include "guilib/TextureManager.h"
 #include "rendering/RenderSystem.h"
@@ -173,6 +174,9 @@ void CGLTexture::LoadToGPU()
     // nothing to load - probably same image (no change)
     return;
   }
+  GUIFRAMEPROFILER_SCOPE("LoadToGPU", "texture");
+  GUIFRAMEPROFILER_COUNT(TEXTURE_UPLOADS);
+
   if (m_texture == 0)
   {
     // Have OpenGL generate a texture object handle for us
@@ -9,6 +9,7 @@
 #include "TextureGLES.h"
 
 #include "ServiceBroker.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/TextureFormats.h"
 #include "guilib/TextureManager.h"
 #include "rendering/RenderSystem.h"
@@ -210,6 +211,9 @@ void CGLESTexture::LoadToGPU()
     // nothing to load - probably same image (no change)
     return;
   }
+  GUIFRAMEPROFILER_SCOPE("LoadToGPU", "texture");
+  GUIFRAMEPROFILER_COUNT(TEXTURE_UPLOADS);
+
   if (m_texture == 0)
   {
     // Have OpenGL generate a texture object handle for us
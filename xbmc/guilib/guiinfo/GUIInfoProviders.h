@@ -21,6 +21,7 @@
 #include "guilib/guiinfo/VisualisationGUIInfo.h"
 #include "guilib/guiinfo/WeatherGUIInfo.h"
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -97,6 +98,13 @@ public:
    */
   bool GetBool(bool& value, const CGUIListItem *item, int contextWindow, const CGUIInfo &info) const;
 
+  /*!
+   * @brief Get the change counter of a bool value from one of the registered providers.
+   * @param info The GUI info (label id + additional data).
+   * @return The counter or nullptr if none of the providers signals changes of the value.
+   */
+  const std::atomic<unsigned int>* GetBoolChangeCounter(const CGUIInfo& info) const;
+
   /*!
    * @brief Set new audio/video/subtitle stream info data at all registered providers.
    * @param audioInfo New audio stream info.
@@ -135,6 +143,12 @@ public:
    */
   CLibraryGUIInfo& GetLibraryInfoProvider() { return m_libraryGUIInfo; }
 
+  /*!
+   * @brief Get the skin guiinfo provider.
+   * @return The skin guiinfo provider.
+   */
+  CSkinGUIInfo& GetSkinInfoProvider() { return m_skinGUIInfo; }
+
 private:
   std::vector<IGUIInfoProvider *> m_providers;
 
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 
 class CFileItem;
@@ -84,6 +85,13 @@ public:
    */
   virtual bool GetBool(bool& value, const CGUIListItem *item, int contextWindow, const CGUIInfo &info) const = 0;
 
+  /*!
+   * @brief Get the counter which is incremented whenever the value of a bool changes.
+   * @param info The GUI info (label id + additional data).
+   * @return The counter or nullptr if the value has to be updated every frame.
+   */
+  virtual const std::atomic<unsigned int>* GetBoolChangeCounter(const CGUIInfo& info) const = 0;
+
   /*!
    * @brief Set new audio/video stream info data.
    * @param audioInfo New audio stream info.
@@ -70,6 +70,7 @@ void CLibraryGUIInfo::SetLibraryBool(int condition, bool value)
     default:
       break;
   }
+  ++m_libraryChangeCounter;
 }
 
 void CLibraryGUIInfo::ResetLibraryBools()
@@ -83,6 +84,7 @@ void CLibraryGUIInfo::ResetLibraryBools()
   m_libraryHasCompilations = -1;
   m_libraryHasBoxsets = -1;
   m_libraryRoleCounts.clear();
+  ++m_libraryChangeCounter;
 }
 
 bool CLibraryGUIInfo::InitCurrentItem(CFileItem *item)
@@ -289,3 +291,24 @@ bool CLibraryGUIInfo::GetBool(bool& value, const CGUIListItem *gitem, int contex
 
   return false;
 }
+
+const std::atomic<unsigned int>* CLibraryGUIInfo::GetBoolChangeCounter(const CGUIInfo& info) const
+{
+  switch (info.m_info)
+  {
+    case LIBRARY_HAS_MUSIC:
+    case LIBRARY_HAS_MOVIES:
+    case LIBRARY_HAS_MOVIE_SETS:
+    case LIBRARY_HAS_TVSHOWS:
+    case LIBRARY_HAS_MUSICVIDEOS:
+    case LIBRARY_HAS_SINGLES:
+    case LIBRARY_HAS_COMPILATIONS:
+    case LIBRARY_HAS_BOXSETS:
+    case LIBRARY_HAS_VIDEO:
+    case LIBRARY_HAS_ROLE:
+      return &m_libraryChangeCounter;
+    default:
+      break;
+  }
+  return nullptr;
+}
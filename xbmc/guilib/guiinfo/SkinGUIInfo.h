@@ -10,6 +10,8 @@
 
 #include "guilib/guiinfo/GUIInfoProvider.h"
 
+#include <atomic>
+
 namespace KODI
 {
 namespace GUILIB
@@ -30,6 +32,15 @@ public:
   bool GetLabel(std::string& value, const CFileItem *item, int contextWindow, const CGUIInfo &info, std::string *fallback) const override;
   bool GetInt(int& value, const CGUIListItem *item, int contextWindow, const CGUIInfo &info) const override;
   bool GetBool(bool& value, const CGUIListItem *item, int contextWindow, const CGUIInfo &info) const override;
+  const std::atomic<unsigned int>* GetBoolChangeCounter(const CGUIInfo& info) const override;
+
+  /*!
+   * @brief Notify the provider that a skin setting has been changed.
+   */
+  void OnSkinSettingChanged() { ++m_settingsChangeCounter; }
+
+private:
+  std::atomic<unsigned int> m_settingsChangeCounter{0};
 };
 
 } // namespace GUIINFO
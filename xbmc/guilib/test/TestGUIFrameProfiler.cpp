@@ -0,0 +1,97 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "guilib/GUIFrameProfiler.h"
+#include "utils/Variant.h"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+void RecordFrames(int frames)
+{
+  for (int i = 0; i < frames; ++i)
+  {
+    CGUIFrameProfiler::GetInstance().NewFrame();
+    GUIFRAMEPROFILER_SCOPE("Process", "gui");
+    {
+      CGUIFrameProfilerScope scope("image", "render", CGUIFrameProfiler::IsProfilingControls(), 7);
+    }
+    GUIFRAMEPROFILER_COUNT(FONT_CACHE_HITS);
+  }
+  CGUIFrameProfiler::GetInstance().NewFrame();
+}
+} // namespace
+
+TEST(TestGUIFrameProfiler, Trace)
+{
+  CGUIFrameProfiler& profiler = CGUIFrameProfiler::GetInstance();
+  profiler.Start(3, true);
+  RecordFrames(5);
+  profiler.Stop();
+
+  // only the most recent frames are kept
+  CVariant trace;
+  profiler.GetTrace(trace);
+  EXPECT_EQ(trace["otherData"]["frames"].asInteger(), 3);
+  EXPECT_FALSE(trace["otherData"]["running"].asBoolean());
+
+  profiler.GetTrace(trace, 2);
+  const CVariant& events = trace["traceEvents"];
+  ASSERT_TRUE(events.isArray());
+  int frames = 0;
+  int sections = 0;
+  for (auto it = events.begin_array(); it != events.end_array(); ++it)
+  {
+    const std::string name = (*it)["name"].asString();
+    if (name == "Frame")
+    {
+      frames++;
+      EXPECT_GE((*it)["dur"].asDouble(), 0.0);
+    }
+    else if (name == "Counters")
+      EXPECT_EQ((*it)["args"]["font cache hits"].asInteger(), 1);
+    else if (name == "Process" || name == "image")
+    {
+      sections++;
+      EXPECT_EQ((*it)["ph"].asString(), "X");
+    }
+  }
+  EXPECT_EQ(frames, 2);
+  EXPECT_EQ(sections, 4);
+}
+
+TEST(TestGUIFrameProfiler, ControlsAreOptional)
+{
+  CGUIFrameProfiler& profiler = CGUIFrameProfiler::GetInstance();
+  profiler.Start(10, false);
+  EXPECT_TRUE(CGUIFrameProfiler::IsRunning());
+  EXPECT_FALSE(CGUIFrameProfiler::IsProfilingControls());
+  RecordFrames(1);
+  profiler.Stop();
+  EXPECT_FALSE(CGUIFrameProfiler::IsRunning());
+
+  // nothing is recorded while the profiler is stopped
+  RecordFrames(3);
+
+  // the frame started by Start() and the recorded one
+  CVariant trace;
+  profiler.GetTrace(trace);
+  EXPECT_EQ(trace["otherData"]["frames"].asInteger(), 2);
+  int sections = 0;
+  for (auto it = trace["traceEvents"].begin_array(); it != trace["traceEvents"].end_array(); ++it)
+  {
+    if ((*it)["cat"].asString() == "render")
+      ADD_FAILURE() << "control section recorded";
+    if ((*it)["name"].asString() == "Process")
+      sections++;
+  }
+  EXPECT_EQ(sections, 1);
+}
@@ -12,8 +12,13 @@
 
 namespace INFO
 {
-InfoBool::InfoBool(const std::string& expression, int context, unsigned int& refreshCounter)
-  : m_context(context), m_expression(expression), m_parentRefreshCounter(refreshCounter)
+InfoBool::InfoBool(const std::string& expression,
+                   int context,
+                   const RefreshCounter& refreshCounter)
+  : m_context(context),
+    m_expression(expression),
+    m_dependencies{&refreshCounter},
+    m_parentRefreshCounter(refreshCounter)
 {
   StringUtils::ToLower(m_expression);
 }
@@ -8,8 +8,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
+#include <vector>
 
 class CGUIListItem;
 class CGUIInfoManager;
@@ -23,7 +25,10 @@ namespace INFO
 class InfoBool
 {
 public:
-  InfoBool(const std::string &expression, int context, unsigned int &refreshCounter);
+  using RefreshCounter = std::atomic<unsigned int>;
+  using Dependencies = std::vector<const RefreshCounter*>;
+
+  InfoBool(const std::string& expression, int context, const RefreshCounter& refreshCounter);
   virtual ~InfoBool() = default;
 
   virtual void Initialize(CGUIInfoManager* infoMgr) { m_infoMgr = infoMgr; }
@@ -37,10 +42,14 @@ public:
   {
     if (item && m_listItemDependent)
       Update(contextWindow, item);
-    else if (m_refreshCounter != m_parentRefreshCounter || m_refreshCounter == 0)
+    else
     {
-      Update(contextWindow, nullptr);
-      m_refreshCounter = m_parentRefreshCounter;
+      const unsigned int refreshCounter = GetRefreshCounter();
+      if (m_refreshCounter != refreshCounter || refreshCounter == 0)
+      {
+        Update(contextWindow, nullptr);
+        m_refreshCounter = refreshCounter;
+      }
     }
     return m_value;
   }
@@ -68,16 +77,40 @@ public:
 
   const std::string &GetExpression() const { return m_expression; }
   bool ListItemDependent() const { return m_listItemDependent; }
+
+  /*! \brief Get the counters whose changes invalidate the cached value
+   By default this is the refresh counter of the info manager, which is incremented every frame.
+   Values which only change on specific events depend on the counters of the info providers
+   instead. An empty list means the value never changes.
+   */
+  const Dependencies& GetDependencies() const { return m_dependencies; }
+
+  /*! \brief Whether the value has to be updated every frame */
+  bool IsVolatile() const
+  {
+    return m_dependencies.size() == 1 && m_dependencies.front() == &m_parentRefreshCounter;
+  }
+
 protected:
   bool m_value = false; ///< current value
   int m_context;               ///< contextual information to go with the condition
   bool m_listItemDependent = false; ///< do not cache if a listitem pointer is given
   std::string  m_expression;   ///< original expression
   CGUIInfoManager* m_infoMgr;
+  Dependencies m_dependencies; ///< counters whose changes invalidate m_value
 
 private:
+  unsigned int GetRefreshCounter() const
+  {
+    // the counters only ever increase, so their sum changes whenever one of them does
+    unsigned int refreshCounter = 0;
+    for (const RefreshCounter* counter : m_dependencies)
+      refreshCounter += counter->load(std::memory_order_relaxed);
+    return refreshCounter;
+  }
+
   unsigned int m_refreshCounter = 0;
-  unsigned int &m_parentRefreshCounter;
+  const RefreshCounter& m_parentRefreshCounter;
 };
 
 typedef std::shared_ptr<InfoBool> InfoPtr;
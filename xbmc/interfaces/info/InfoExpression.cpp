@@ -9,8 +9,10 @@
 #include "InfoExpression.h"
 
 #include "GUIInfoManager.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "utils/log.h"
 
+#include <algorithm>
 #include <list>
 #include <memory>
 #include <stack>
@@ -21,10 +23,13 @@ void InfoSingle::Initialize(CGUIInfoManager* infoMgr)
 {
   InfoBool::Initialize(infoMgr);
   m_condition = m_infoMgr->TranslateSingleString(m_expression, m_listItemDependent);
+  m_dependencies = m_infoMgr->GetDependencies(m_condition, m_dependencies);
 }
 
 void InfoSingle::Update(int contextWindow, const CGUIListItem* item)
 {
+  GUIFRAMEPROFILER_COUNT(INFOBOOL_UPDATES);
+
   // use propagated context in case this info has the default context (i.e. if not tied to a specific window)
   // its value might depend on the context in which the evaluation was called
   int context = m_context == DEFAULT_CONTEXT ? contextWindow : m_context;
@@ -39,14 +44,50 @@ void InfoExpression::Initialize(CGUIInfoManager* infoMgr)
     CLog::Log(LOGERROR, "Error parsing boolean expression {}", m_expression);
     m_expression_tree = std::make_shared<InfoLeaf>(m_infoMgr->Register("false", 0), false);
   }
+
+  std::optional<bool> value = Fold(m_expression_tree);
+  if (value)
+  {
+    m_constantValue = *value;
+    m_dependencies.clear();
+  }
+  else
+  {
+    Compile(m_expression_tree);
+
+    // the expression only needs to be updated if one of its leaves may have changed
+    Dependencies dependencies;
+    bool isVolatile = false;
+    for (const auto& leaf : m_leaves)
+    {
+      if (leaf->IsVolatile())
+        isVolatile = true;
+      for (const RefreshCounter* counter : leaf->GetDependencies())
+      {
+        if (std::find(dependencies.begin(), dependencies.end(), counter) == dependencies.end())
+          dependencies.push_back(counter);
+      }
+    }
+    if (!isVolatile)
+      m_dependencies = std::move(dependencies);
+  }
+  m_expression_tree.reset();
 }
 
 void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
 {
+  GUIFRAMEPROFILER_COUNT(INFOBOOL_UPDATES);
+
+  if (m_program.empty())
+  {
+    m_value = m_constantValue;
+    return;
+  }
+
   // use propagated context in case this info expression has the default context (i.e. if not tied to a specific window)
   // its value might depend on the context in which the evaluation was called
   int context = m_context == DEFAULT_CONTEXT ? contextWindow : m_context;
-  m_value = m_expression_tree->Evaluate(context, item);
+  m_value = Evaluate(0, context, item);
 }
 
 /* Expressions are rewritten at parse time into a form which favours the
@@ -67,11 +108,6 @@ void InfoExpression::Update(int contextWindow, const CGUIListItem* item)
  *    operations. So [A|B]|[C|D+[[E|F]|G] becomes A|B|C|[D+[E|F|G]].
  */
 
-bool InfoExpression::InfoLeaf::Evaluate(int contextWindow, const CGUIListItem* item)
-{
-  return m_invert ^ m_info->Get(contextWindow, item);
-}
-
 InfoExpression::InfoAssociativeGroup::InfoAssociativeGroup(
     node_type_t type,
     const InfoSubexpressionPtr &left,
@@ -92,27 +128,111 @@ void InfoExpression::InfoAssociativeGroup::Merge(const std::shared_ptr<InfoAssoc
   m_children.splice(m_children.end(), other->m_children);
 }
 
-bool InfoExpression::InfoAssociativeGroup::Evaluate(int contextWindow, const CGUIListItem* item)
+bool InfoExpression::Evaluate(size_t pos, int contextWindow, const CGUIListItem* item)
 {
+  const Instruction& instruction = m_program[pos];
+  if (instruction.type == NODE_LEAF)
+    return instruction.invert ^ instruction.info->Get(contextWindow, item);
+
   /* Handle either AND or OR by using the relation
    * A AND B == !(!A OR !B)
    * to convert ANDs into ORs
    */
-  std::list<InfoSubexpressionPtr>::iterator last = m_children.end();
-  std::list<InfoSubexpressionPtr>::iterator it = m_children.begin();
-  bool use_and = (m_type == NODE_AND);
-  bool result = use_and ^ (*it)->Evaluate(contextWindow, item);
-  while (!result && ++it != last)
+  const bool use_and = (instruction.type == NODE_AND);
+  const size_t first = pos + 1;
+  const size_t last = pos + instruction.size;
+  for (size_t child = first; child < last; child += m_program[child].size)
   {
-    result = use_and ^ (*it)->Evaluate(contextWindow, item);
-    if (result)
+    if (use_and ^ Evaluate(child, contextWindow, item))
     {
-      /* Move this child to the head of the list so we evaluate faster next time */
-      m_children.push_front(*it);
-      m_children.erase(it);
+      /* Move this child to the front of the group so we evaluate faster next time */
+      if (child != first)
+        std::rotate(m_program.begin() + first, m_program.begin() + child,
+                    m_program.begin() + child + m_program[child].size);
+      return !use_and;
     }
   }
-  return use_and ^ result;
+  return use_and;
+}
+
+std::optional<bool> InfoExpression::Fold(InfoSubexpressionPtr& node)
+{
+  if (node->Type() == NODE_LEAF)
+  {
+    const auto leaf = std::static_pointer_cast<InfoLeaf>(node);
+    if (!leaf->m_info->GetDependencies().empty() || leaf->m_info->ListItemDependent())
+      return {};
+    return leaf->m_invert ^ leaf->m_info->Get(m_context);
+  }
+
+  const bool use_and = (node->Type() == NODE_AND);
+  std::list<InfoSubexpressionPtr>& children =
+      std::static_pointer_cast<InfoAssociativeGroup>(node)->GetChildren();
+  for (auto it = children.begin(); it != children.end();)
+  {
+    const std::optional<bool> value = Fold(*it);
+    if (!value)
+    {
+      ++it;
+      continue;
+    }
+    // a false child decides an AND, a true one an OR - all others can be dropped
+    if (*value != use_and)
+      return *value;
+    it = children.erase(it);
+  }
+
+  // drop repeated leaves, a leaf and its inversion decide the group
+  for (auto it = children.begin(); it != children.end(); ++it)
+  {
+    if ((*it)->Type() != NODE_LEAF)
+      continue;
+    const auto leaf = std::static_pointer_cast<InfoLeaf>(*it);
+    for (auto other = std::next(it); other != children.end();)
+    {
+      const auto otherLeaf = std::static_pointer_cast<InfoLeaf>(*other);
+      if ((*other)->Type() != NODE_LEAF || otherLeaf->m_info != leaf->m_info)
+        ++other;
+      else if (otherLeaf->m_invert == leaf->m_invert)
+        other = children.erase(other);
+      else
+        return !use_and;
+    }
+  }
+
+  if (children.empty())
+    return use_and;
+  if (children.size() == 1)
+    node = children.front();
+  return {};
+}
+
+void InfoExpression::Compile(const InfoSubexpressionPtr& node)
+{
+  if (node->Type() == NODE_LEAF)
+  {
+    const auto leaf = std::static_pointer_cast<InfoLeaf>(node);
+    m_program.push_back({NODE_LEAF, leaf->m_invert, 1, leaf->m_info.get()});
+    m_leaves.push_back(leaf->m_info);
+    return;
+  }
+
+  const size_t pos = m_program.size();
+  m_program.push_back({node->Type(), false, 0, nullptr});
+  CompileChildren(node->Type(), node);
+  m_program[pos].size = static_cast<unsigned int>(m_program.size() - pos);
+}
+
+void InfoExpression::CompileChildren(node_type_t type, const InfoSubexpressionPtr& node)
+{
+  for (const auto& child : std::static_pointer_cast<InfoAssociativeGroup>(node)->GetChildren())
+  {
+    // folding may have left groups directly inside a group of the same type
+    if (child->Type() == type)
+      CompileChildren(type, child);
+    else
+      Compile(child);
+  }
 }
 
 /* Expressions are parsed using the shunting-yard algorithm. Binary operators
@@ -203,6 +323,22 @@ void InfoExpression::OperatorPop(std::stack<operator_t> &operator_stack, bool &i
   }
 }
 
+bool InfoExpression::AddLeaf(const std::string& operand,
+                             bool invert,
+                             std::stack<InfoSubexpressionPtr>& nodes)
+{
+  InfoPtr info = m_infoMgr->Register(operand, m_context);
+  if (!info)
+  {
+    CLog::Log(LOGERROR, "Bad operand '{}'", operand);
+    return false;
+  }
+  /* Propagate any listItem dependency from the operand to the expression */
+  m_listItemDependent |= info->ListItemDependent();
+  nodes.push(std::make_shared<InfoLeaf>(std::move(info), invert));
+  return true;
+}
+
 bool InfoExpression::Parse(const std::string &expression)
 {
   const char *s = expression.c_str();
@@ -210,6 +346,7 @@ bool InfoExpression::Parse(const std::string &expression)
   std::stack<operator_t> operator_stack;
   bool invert = false;
   std::stack<InfoSubexpressionPtr> nodes;
+  std::stack<const char*> brackets;
   // The next two are for syntax-checking purposes
   bool after_binaryoperator = true;
   int bracket_count = 0;
@@ -231,7 +368,10 @@ bool InfoExpression::Parse(const std::string &expression)
         return false;
       }
       if (c == '[')
+      {
         bracket_count++;
+        brackets.push(s);
+      }
       else if (c == ']' && bracket_count-- == 0)
       {
         CLog::Log(LOGERROR, "Unmatched ]");
@@ -239,15 +379,8 @@ bool InfoExpression::Parse(const std::string &expression)
       }
       if (!operand.empty())
       {
-        InfoPtr info = m_infoMgr->Register(operand, m_context);
-        if (!info)
-        {
-          CLog::Log(LOGERROR, "Bad operand '{}'", operand);
+        if (!AddLeaf(operand, invert, nodes))
           return false;
-        }
-        /* Propagate any listItem dependency from the operand to the expression */
-        m_listItemDependent |= info->ListItemDependent();
-        nodes.push(std::make_shared<InfoLeaf>(info, invert));
         /* Reuse operand string for next operand */
         operand.clear();
       }
@@ -260,7 +393,19 @@ bool InfoExpression::Parse(const std::string &expression)
           OperatorPop(operator_stack, invert, nodes);
       }
       if (op == OPERATOR_RB)
+      {
         operator_stack.pop(); // remove the matching left-bracket
+
+        /* Replace the bracketed subexpression by an info bool of its own, which is shared with
+         * all other expressions containing the same subexpression and only evaluated once.
+         * The inversion in effect for the brackets is applied to it like to any other leaf.
+         */
+        std::string subexpression(brackets.top(), s - 1);
+        brackets.pop();
+        nodes.pop();
+        if (!AddLeaf(subexpression, invert, nodes))
+          return false;
+      }
       else
         operator_stack.push(op);
       if (op == OPERATOR_NOT)
@@ -290,15 +435,8 @@ bool InfoExpression::Parse(const std::string &expression)
   }
   if (!operand.empty())
   {
-    InfoPtr info = m_infoMgr->Register(operand, m_context);
-    if (!info)
-    {
-      CLog::Log(LOGERROR, "Bad operand '{}'", operand);
+    if (!AddLeaf(operand, invert, nodes))
       return false;
-    }
-    /* Propagate any listItem dependency from the operand to the expression */
-    m_listItemDependent |= info->ListItemDependent();
-    nodes.push(std::make_shared<InfoLeaf>(info, invert));
   }
   while (!operator_stack.empty())
     OperatorPop(operator_stack, invert, nodes);
@@ -11,6 +11,7 @@
 #include "InfoBool.h"
 
 #include <list>
+#include <optional>
 #include <stack>
 #include <utility>
 #include <vector>
@@ -24,7 +25,7 @@ namespace INFO
 class InfoSingle : public InfoBool
 {
 public:
-  InfoSingle(const std::string& expression, int context, unsigned int& refreshCounter)
+  InfoSingle(const std::string& expression, int context, const RefreshCounter& refreshCounter)
     : InfoBool(expression, context, refreshCounter)
   {
   }
@@ -37,11 +38,15 @@ private:
 };
 
 /*! \brief Class to wrap active boolean expressions
+
+ The parsed expression is compiled into a flat list of instructions. Leaves with a constant
+ value are folded into their groups, bracketed subexpressions are registered as info bools of
+ their own so that they are shared with (and cached for) all expressions containing them.
  */
 class InfoExpression : public InfoBool
 {
 public:
-  InfoExpression(const std::string& expression, int context, unsigned int& refreshCounter)
+  InfoExpression(const std::string& expression, int context, const RefreshCounter& refreshCounter)
     : InfoBool(expression, context, refreshCounter)
   {
   }
@@ -74,7 +79,6 @@ private:
   {
   public:
     virtual ~InfoSubexpression(void) = default; // so we can destruct derived classes using a pointer to their base class
-    virtual bool Evaluate(int contextWindow, const CGUIListItem* item) = 0;
     virtual node_type_t Type() const=0;
   };
 
@@ -85,10 +89,8 @@ private:
   {
   public:
     InfoLeaf(InfoPtr info, bool invert) : m_info(std::move(info)), m_invert(invert) {}
-    bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return NODE_LEAF; }
 
-  private:
     InfoPtr m_info;
     bool m_invert;
   };
@@ -100,18 +102,42 @@ private:
     InfoAssociativeGroup(node_type_t type, const InfoSubexpressionPtr &left, const InfoSubexpressionPtr &right);
     void AddChild(const InfoSubexpressionPtr &child);
     void Merge(const std::shared_ptr<InfoAssociativeGroup>& other);
-    bool Evaluate(int contextWindow, const CGUIListItem* item) override;
     node_type_t Type() const override { return m_type; }
 
+    std::list<InfoSubexpressionPtr>& GetChildren() { return m_children; }
+
   private:
     node_type_t m_type;
     std::list<InfoSubexpressionPtr> m_children;
   };
 
+  // An instruction of the compiled expression. The instructions are stored in prefix order, so
+  // every group is directly followed by its children and a subexpression is a contiguous range.
+  struct Instruction
+  {
+    node_type_t type;
+    bool invert; ///< invert the value of the leaf
+    unsigned int size; ///< number of instructions of the subexpression, including this one
+    InfoBool* info; ///< the leaf, kept alive by m_leaves
+  };
+
   static operator_t GetOperator(char ch);
   static void OperatorPop(std::stack<operator_t> &operator_stack, bool &invert, std::stack<InfoSubexpressionPtr> &nodes);
   bool Parse(const std::string &expression);
-  InfoSubexpressionPtr m_expression_tree;
+  bool AddLeaf(const std::string& operand, bool invert, std::stack<InfoSubexpressionPtr>& nodes);
+
+  /*! \brief Simplify the subexpression
+   \return the value of the subexpression if it is constant, an empty optional otherwise
+   */
+  std::optional<bool> Fold(InfoSubexpressionPtr& node);
+  void Compile(const InfoSubexpressionPtr& node);
+  void CompileChildren(node_type_t type, const InfoSubexpressionPtr& node);
+  bool Evaluate(size_t pos, int contextWindow, const CGUIListItem* item);
+
+  std::vector<Instruction> m_program;
+  std::vector<InfoPtr> m_leaves;
+  bool m_constantValue = false; ///< value of the expression if m_program is empty
+  InfoSubexpressionPtr m_expression_tree; ///< only used until the expression is compiled
 };
 
 };
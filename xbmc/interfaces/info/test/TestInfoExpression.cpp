@@ -0,0 +1,133 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "GUIInfoManager.h"
+#include "guilib/guiinfo/GUIInfoLabels.h"
+#include "interfaces/info/InfoBool.h"
+
+#include <random>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// operands with a known value: two constant ones and two which are evaluated every frame
+const struct
+{
+  const char* expression;
+  bool value;
+} operands[] = {
+    {"true", true},
+    {"false", false},
+    {"integer.isequal(1,1)", true},
+    {"integer.isequal(1,0)", false},
+};
+
+// builds a random expression and its expected value using the precedence ! > + > |
+std::string RandomExpression(std::mt19937& rng, int depth, bool& value)
+{
+  const int choice = static_cast<int>(rng() % (depth > 0 ? 6 : 2));
+  if (choice == 0)
+  {
+    const auto& operand = operands[rng() % 4];
+    value = operand.value;
+    return operand.expression;
+  }
+  if (choice == 1)
+  {
+    const std::string expression = RandomExpression(rng, depth - 1, value);
+    value = !value;
+    return "![" + expression + "]";
+  }
+  if (choice == 2)
+  {
+    const std::string expression = RandomExpression(rng, depth - 1, value);
+    return "[" + expression + "]";
+  }
+
+  bool left;
+  bool right;
+  const std::string leftExpression = RandomExpression(rng, depth - 1, left);
+  const std::string rightExpression = RandomExpression(rng, depth - 1, right);
+  if (choice == 3)
+  {
+    value = left && right;
+    return "[" + leftExpression + " + " + rightExpression + "]";
+  }
+  value = left || right;
+  return "[" + leftExpression + " | " + rightExpression + "]";
+}
+} // namespace
+
+TEST(TestInfoExpression, Evaluate)
+{
+  CGUIInfoManager infoMgr;
+  EXPECT_TRUE(infoMgr.EvaluateBool("true | false + false", 0));
+  EXPECT_FALSE(infoMgr.EvaluateBool("[true | false] + false", 0));
+  EXPECT_TRUE(infoMgr.EvaluateBool("!false + !integer.isequal(1,0)", 0));
+  EXPECT_FALSE(infoMgr.EvaluateBool("![integer.isequal(1,1) | false]", 0));
+  EXPECT_TRUE(infoMgr.EvaluateBool("integer.isequal(1,0) | !integer.isequal(1,0)", 0));
+  EXPECT_FALSE(infoMgr.EvaluateBool("integer.isequal(1,1) + !integer.isequal(1,1)", 0));
+  EXPECT_FALSE(infoMgr.EvaluateBool("[integer.isequal(1,1) + ", 0));
+}
+
+TEST(TestInfoExpression, RandomExpressions)
+{
+  CGUIInfoManager infoMgr;
+  std::mt19937 rng(42);
+  for (int i = 0; i < 500; ++i)
+  {
+    bool expected;
+    const std::string expression = RandomExpression(rng, 5, expected);
+    const INFO::InfoPtr info = infoMgr.Register(expression);
+    ASSERT_NE(info, nullptr);
+
+    // evaluate repeatedly, so the reordering of the groups comes into play
+    for (int frame = 0; frame < 3; ++frame)
+    {
+      EXPECT_EQ(info->Get(0), expected) << expression;
+      EXPECT_EQ(info->Get(0), expected) << expression;
+      infoMgr.ResetFrameCache();
+    }
+    infoMgr.ResetCache();
+    EXPECT_EQ(info->Get(0), expected) << expression;
+  }
+}
+
+TEST(TestInfoExpression, Dependencies)
+{
+  CGUIInfoManager infoMgr;
+  auto& library = infoMgr.GetInfoProviders().GetLibraryInfoProvider();
+  library.SetLibraryBool(LIBRARY_HAS_MUSIC, true);
+  library.SetLibraryBool(LIBRARY_HAS_MOVIES, false);
+
+  const INFO::InfoPtr constant = infoMgr.Register("true + !false");
+  EXPECT_TRUE(constant->GetDependencies().empty());
+  EXPECT_TRUE(constant->Get(0));
+
+  const INFO::InfoPtr everyFrame = infoMgr.Register("library.hasmusic + integer.isequal(1,1)");
+  EXPECT_TRUE(everyFrame->IsVolatile());
+  EXPECT_TRUE(everyFrame->Get(0));
+
+  const INFO::InfoPtr stable = infoMgr.Register("library.hasmusic + !library.hasmovies");
+  EXPECT_FALSE(stable->IsVolatile());
+  EXPECT_FALSE(stable->GetDependencies().empty());
+  EXPECT_TRUE(stable->Get(0));
+  infoMgr.ResetFrameCache();
+  EXPECT_TRUE(stable->Get(0));
+
+  // changes of the library bools invalidate the cached values without a reset of the caches
+  library.SetLibraryBool(LIBRARY_HAS_MOVIES, true);
+  EXPECT_FALSE(stable->Get(0));
+  EXPECT_TRUE(everyFrame->Get(0));
+  library.SetLibraryBool(LIBRARY_HAS_MUSIC, false);
+  EXPECT_FALSE(stable->Get(0));
+  infoMgr.ResetFrameCache();
+  EXPECT_FALSE(everyFrame->Get(0));
+}
@@ -16,6 +16,7 @@
 #include "application/Application.h"
 #include "dialogs/GUIDialogKaiToast.h"
 #include "guilib/GUIComponent.h"
+#include "guilib/GUIFrameProfiler.h"
 #include "guilib/GUIWindowManager.h"
 #include "guilib/StereoscopicsManager.h"
 #include "input/WindowTranslator.h"
@@ -139,6 +140,39 @@ JSONRPC_STATUS CGUIOperations::ActivateScreenSaver(const std::string& method,
   return ACK;
 }
 
+JSONRPC_STATUS CGUIOperations::StartProfiler(const std::string& method,
+                                             ITransportLayer* transport,
+                                             IClient* client,
+                                             const CVariant& parameterObject,
+                                             CVariant& result)
+{
+  CGUIFrameProfiler::GetInstance().Start(
+      static_cast<unsigned int>(parameterObject["frames"].asUnsignedInteger()),
+      parameterObject["controls"].asBoolean());
+  return ACK;
+}
+
+JSONRPC_STATUS CGUIOperations::StopProfiler(const std::string& method,
+                                            ITransportLayer* transport,
+                                            IClient* client,
+                                            const CVariant& parameterObject,
+                                            CVariant& result)
+{
+  CGUIFrameProfiler::GetInstance().Stop();
+  return ACK;
+}
+
+JSONRPC_STATUS CGUIOperations::GetProfile(const std::string& method,
+                                          ITransportLayer* transport,
+                                          IClient* client,
+                                          const CVariant& parameterObject,
+                                          CVariant& result)
+{
+  CGUIFrameProfiler::GetInstance().GetTrace(
+      result, static_cast<unsigned int>(parameterObject["frames"].asUnsignedInteger()));
+  return OK;
+}
+
 JSONRPC_STATUS CGUIOperations::GetPropertyValue(const std::string &property, CVariant &result)
 {
   if (property == "currentwindow")
@@ -178,6 +178,9 @@ JsonRpcMethodMap CJSONServiceDescription::m_methodMaps[] = {
   { "GUI.SetStereoscopicMode",                      CGUIOperations::SetStereoscopicMode },
   { "GUI.GetStereoscopicModes",                     CGUIOperations::GetStereoscopicModes },
   { "GUI.ActivateScreenSaver",                      CGUIOperations::ActivateScreenSaver},
+  { "GUI.StartProfiler",                            CGUIOperations::StartProfiler },
+  { "GUI.StopProfiler",                             CGUIOperations::StopProfiler },
+  { "GUI.GetProfile",                               CGUIOperations::GetProfile },
 
 // PVR operations
   { "PVR.GetProperties",                            CPVROperations::GetProperties },
@@ -901,5 +901,6 @@ JSONRPC_STATUS CSettingsOperations::SetSkinSettingValue(const std::string& metho
     return InvalidParams;
   }
 
+  CSkinSettings::GetInstance().OnSettingChanged();
   return OK;
 }
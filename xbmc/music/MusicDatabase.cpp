@@ -1047,17 +1047,24 @@ int CMusicDatabase::AddSong(const int idSong,
 
     if (idSong <= 1)
     {
+      dbiplus::ParamValues params;
       if (!strMusicBrainzTrackID.empty())
-        strSQL = PrepareSQL("SELECT idSong FROM song WHERE "
-                            "idAlbum = %i AND iTrack=%i AND strMusicBrainzTrackID = '%s'",
-                            idAlbum, iTrack, strMusicBrainzTrackID.c_str());
+      {
+        strSQL = "SELECT idSong FROM song WHERE "
+                 "idAlbum = ? AND iTrack=? AND strMusicBrainzTrackID = ?";
+        params = {dbiplus::field_value(idAlbum), dbiplus::field_value(iTrack),
+                  dbiplus::field_value(strMusicBrainzTrackID)};
+      }
       else
-        strSQL = PrepareSQL("SELECT idSong FROM song WHERE "
-                            "idAlbum=%i AND strFileName='%s' AND strTitle='%s' AND iTrack=%i "
-                            "AND strMusicBrainzTrackID IS NULL",
-                            idAlbum, strFileName.c_str(), strTitle.c_str(), iTrack);
+      {
+        strSQL = "SELECT idSong FROM song WHERE "
+                 "idAlbum=? AND strFileName=? AND strTitle=? AND iTrack=? "
+                 "AND strMusicBrainzTrackID IS NULL";
+        params = {dbiplus::field_value(idAlbum), dbiplus::field_value(strFileName),
+                  dbiplus::field_value(strTitle), dbiplus::field_value(iTrack)};
+      }
 
-      if (!m_pDS->query(strSQL))
+      if (!m_pDS->query(strSQL, params))
         return -1;
     }
     if (m_pDS->num_rows() == 0)
@@ -3038,16 +3045,14 @@ int CMusicDatabase::AddPath(const std::string& strPath1)
     if (it != m_pathCache.end())
       return it->second;
 
-    strSQL = PrepareSQL("SELECT * FROM path WHERE strPath='%s'", strPath.c_str());
-    m_pDS->query(strSQL);
+    strSQL = "SELECT * FROM path WHERE strPath=?";
+    m_pDS->query(strSQL, {dbiplus::field_value(strPath)});
     if (m_pDS->num_rows() == 0)
     {
       m_pDS->close();
       // doesn't exists, add it
-      strSQL = PrepareSQL("INSERT INTO path (idPath, strPath) "
-                          "VALUES(NULL, '%s')",
-                          strPath.c_str());
-      m_pDS->exec(strSQL);
+      strSQL = "INSERT INTO path (idPath, strPath) VALUES(NULL, ?)";
+      m_pDS->exec(strSQL, {dbiplus::field_value(strPath)});
 
       int idPath = (int)m_pDS->lastinsertid();
       m_pathCache.insert(std::pair<std::string, int>(strPath, idPath));
@@ -8351,56 +8356,6 @@ bool CMusicDatabase::GetSongsByWhereJSON(
   return false;
 }
 
-std::string CMusicDatabase::GetIgnoreArticleSQL(const std::string& strField)
-{
-  /*
-  Make SQL clause from ignore article list.
-  Group tokens the same length together, for example :
-    WHEN strArtist LIKE 'the ' OR strArtist LIKE 'the.' strArtist LIKE 'the_' ESCAPE '_'
-    THEN SUBSTR(strArtist, 5)
-    WHEN strArtist LIKE 'an ' OR strArtist LIKE 'an.' strArtist LIKE 'an_' ESCAPE '_'
-    THEN SUBSTR(strArtist, 4)
-  */
-  std::set<std::string> sortTokens = g_langInfo.GetSortTokens();
-  std::string sortclause;
-  size_t tokenlength = 0;
-  std::string strWhen;
-  for (const auto& token : sortTokens)
-  {
-    if (token.length() != tokenlength)
-    {
-      if (!strWhen.empty())
-      {
-        if (!sortclause.empty())
-          sortclause += " ";
-        std::string strThen = PrepareSQL(" THEN SUBSTR(%s, %i)", strField.c_str(), tokenlength + 1);
-        sortclause += "WHEN " + strWhen + strThen;
-        strWhen.clear();
-      }
-      tokenlength = token.length();
-    }
-    std::string tokenclause = token;
-    //Escape any ' or % in the token
-    StringUtils::Replace(tokenclause, "'", "''");
-    StringUtils::Replace(tokenclause, "%", "%%");
-    // Single %, _ and ' so avoid using PrepareSQL
-    tokenclause = strField + " LIKE '" + tokenclause + "%'";
-    if (token.find('_') != std::string::npos)
-      tokenclause += " ESCAPE '_'";
-    if (!strWhen.empty())
-      strWhen += " OR ";
-    strWhen += tokenclause;
-  }
-  if (!strWhen.empty())
-  {
-    if (!sortclause.empty())
-      sortclause += " ";
-    std::string strThen = PrepareSQL(" THEN SUBSTR(%s, %i)", strField.c_str(), tokenlength + 1);
-    sortclause += "WHEN " + strWhen + strThen;
-  }
-  return sortclause;
-}
-
 std::string CMusicDatabase::SortnameBuildSQL(const std::string& strAlias,
                                              const SortAttribute& sortAttributes,
                                              const std::string& strField,
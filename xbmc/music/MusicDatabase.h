@@ -948,12 +948,6 @@ private:
   void NormaliseSongDates(std::string& strRelease, std::string& strOriginal);
   bool TrimImageURLs(std::string& strImage, const size_t space);
 
-  /*! \brief Build SQL  for sort subquery from ignore article token list
-  \param strField original name or title field that articles could be removed from
-  \return SQL string e.g.  WHEN strField LIKE 'the_' ESCAPE '_' THEN SUBSTR(strArtist, 5)
-  */
-  std::string GetIgnoreArticleSQL(const std::string& strField);
-
   /*! \brief Build SQL for sort name scalar subquery from sort attributes and ignore article list.
   \param strAlias alias name of scalar subquery field
   \param sortAttributes the sort attributes e.g. SortAttributeIgnoreArticle
@@ -14,10 +14,12 @@
 #include "network/Network.h"
 #include "settings/AdvancedSettings.h"
 #include "settings/SettingsComponent.h"
+#include "utils/JSONVariantWriter.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 #include "websocket/WebSocketManager.h"
 
+#include <memory>
 #include <mutex>
 #include <stdio.h>
 #include <stdlib.h>
@@ -54,6 +56,7 @@ static const bdaddr_t bt_bdaddr_local = {{0, 0, 0, 0xff, 0xff, 0xff}};
 using namespace JSONRPC;
 
 #define RECEIVEBUFFER 4096
+#define SENDBUFFER 65536
 
 namespace
 {
@@ -510,6 +513,7 @@ CTCPServer::CTCPClient::CTCPClient()
   m_endBrackets = 0;
   m_beginChar = 0;
   m_endChar = 0;
+  m_failed = false;
 
   m_addrlen = sizeof(m_cliaddr);
 }
@@ -551,6 +555,21 @@ void CTCPServer::CTCPClient::Send(const char *data, unsigned int size)
   } while (sent < size);
 }
 
+void CTCPServer::CTCPClient::Send(CJSONVariantStream& response)
+{
+  std::vector<char> buffer(SENDBUFFER);
+  size_t size;
+  while ((size = response.Read(buffer.data(), buffer.size())) > 0)
+    Send(buffer.data(), static_cast<unsigned int>(size));
+
+  if (response.HasFailed())
+  {
+    // the beginning of the response is sent already, the client can't parse anything after it
+    CLog::Log(LOGERROR, "JSONRPC Server: Failed to serialize the response, closing the connection");
+    m_failed = true;
+  }
+}
+
 void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
   m_new = false;
@@ -614,10 +633,14 @@ void CTCPServer::CTCPClient::PushBuffer(CTCPServer *host, const char *buffer, in
       }
       if (m_beginBrackets > 0 && m_endBrackets > 0 && m_beginBrackets == m_endBrackets)
       {
-        std::string line = CJSONRPC::MethodCall(m_buffer, host, this);
-        Send(line.c_str(), line.size());
+        std::unique_ptr<CJSONVariantStream> response =
+            CJSONRPC::MethodCallStream(m_buffer, host, this);
+        if (response)
+          Send(*response);
         m_beginChar = m_beginBrackets = m_endBrackets = 0;
         m_buffer.clear();
+        if (Closing())
+          return;
       }
     }
   }
@@ -646,6 +669,7 @@ void CTCPServer::CTCPClient::Copy(const CTCPClient& client)
   m_beginChar         = client.m_beginChar;
   m_endChar           = client.m_endChar;
   m_buffer            = client.m_buffer;
+  m_failed            = client.m_failed;
 }
 
 CTCPServer::CWebSocketClient::CWebSocketClient(CWebSocket *websocket)
@@ -695,6 +719,21 @@ void CTCPServer::CWebSocketClient::Send(const char *data, unsigned int size)
     CTCPClient::Send(frames.at(index)->GetFrameData(), (unsigned int)frames.at(index)->GetFrameLength());
 }
 
+void CTCPServer::CWebSocketClient::Send(CJSONVariantStream& response)
+{
+  // the response has to go out as a single text frame
+  std::string data;
+  std::vector<char> buffer(SENDBUFFER);
+  size_t size;
+  while ((size = response.Read(buffer.data(), buffer.size())) > 0)
+    data.append(buffer.data(), size);
+
+  if (response.HasFailed())
+    CLog::Log(LOGERROR, "JSONRPC Server: Failed to serialize the response");
+  else
+    Send(data.c_str(), static_cast<unsigned int>(data.size()));
+}
+
 void CTCPServer::CWebSocketClient::PushBuffer(CTCPServer *host, const char *buffer, int length)
 {
   bool send;
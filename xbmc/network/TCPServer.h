@@ -21,6 +21,7 @@
 
 #include "PlatformDefs.h"
 
+class CJSONVariantStream;
 class CVariant;
 
 namespace JSONRPC
@@ -65,11 +66,14 @@ namespace JSONRPC
       bool SetAnnouncementFlags(int flags) override;
 
       virtual void Send(const char *data, unsigned int size);
+      //! sends the response piece by piece while it is being serialized
+      virtual void Send(CJSONVariantStream& response);
       virtual void PushBuffer(CTCPServer *host, const char *buffer, int length);
       virtual void Disconnect();
 
       virtual bool IsNew() const { return m_new; }
-      virtual bool Closing() const { return false; }
+      //! true after a response couldn't be sent completely
+      virtual bool Closing() const { return m_failed; }
 
       SOCKET m_socket;
       sockaddr_storage m_cliaddr;
@@ -84,6 +88,7 @@ namespace JSONRPC
       int m_beginBrackets, m_endBrackets;
       char m_beginChar, m_endChar;
       std::string m_buffer;
+      bool m_failed;
     };
 
     class CWebSocketClient : public CTCPClient
@@ -96,6 +101,7 @@ namespace JSONRPC
       ~CWebSocketClient() override;
 
       void Send(const char *data, unsigned int size) override;
+      void Send(CJSONVariantStream& response) override;
       void PushBuffer(CTCPServer *host, const char *buffer, int length) override;
       void Disconnect() override;
 
@@ -14,11 +14,14 @@
 #include "interfaces/json-rpc/JSONServiceDescription.h"
 #include "network/httprequesthandler/HTTPRequestHandlerUtils.h"
 #include "utils/FileUtils.h"
-#include "utils/JSONVariantWriter.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 
+#include <algorithm>
+
 #define MAX_HTTP_POST_SIZE 65536
+// responses up to this size are sent in one piece with a Content-Length header
+#define MAX_HTTP_RESPONSE_BUFFER_SIZE 65536
 
 bool CHTTPJsonRpcHandler::CanHandleRequest(const HTTPRequest &request) const
 {
@@ -72,10 +75,46 @@ MHD_RESULT CHTTPJsonRpcHandler::HandleRequest()
 
   if (isRequest)
   {
-    m_responseData = JSONRPC::CJSONRPC::MethodCall(m_requestData, &m_transportLayer, &client);
+    m_responseStream =
+        JSONRPC::CJSONRPC::MethodCallStream(m_requestData, &m_transportLayer, &client);
 
     if (!jsonpCallback.empty())
-      m_responseData = jsonpCallback + "(" + m_responseData + ");";
+    {
+      m_responseData = jsonpCallback + "(";
+      m_responseSuffix = ");";
+    }
+
+    if (m_responseStream != nullptr)
+    {
+      // serialize the beginning of the response, most of them are complete after that
+      const size_t prefixSize = m_responseData.size();
+      m_responseData.resize(prefixSize + MAX_HTTP_RESPONSE_BUFFER_SIZE);
+      m_responseData.resize(prefixSize + m_responseStream->Read(&m_responseData[prefixSize],
+                                                                 MAX_HTTP_RESPONSE_BUFFER_SIZE));
+      if (m_responseStream->HasFailed())
+      {
+        m_response.type = HTTPError;
+        m_response.status = MHD_HTTP_INTERNAL_SERVER_ERROR;
+
+        return MHD_YES;
+      }
+
+      if (!m_responseStream->IsComplete())
+      {
+        // the rest is serialized while the response is sent
+        m_requestData.clear();
+
+        m_response.type = HTTPStreamDownload;
+        m_response.status = MHD_HTTP_OK;
+        m_response.contentType = "application/json";
+
+        return MHD_YES;
+      }
+
+      m_responseStream.reset();
+    }
+
+    m_responseData += m_responseSuffix;
   }
   else if (jsonpCallback.empty())
   {
@@ -118,6 +157,44 @@ HttpResponseRanges CHTTPJsonRpcHandler::GetResponseData() const
   return ranges;
 }
 
+ssize_t CHTTPJsonRpcHandler::ReadResponseStream(char* buffer, size_t size)
+{
+  if (m_responseStream == nullptr)
+    return -1;
+
+  size_t written = 0;
+  if (m_responseOffset < m_responseData.size())
+  {
+    written = std::min(size, m_responseData.size() - m_responseOffset);
+    memcpy(buffer, m_responseData.c_str() + m_responseOffset, written);
+    m_responseOffset += written;
+    if (m_responseOffset == m_responseData.size())
+      std::string().swap(m_responseData);
+  }
+
+  if (written < size && !m_responseStream->IsComplete())
+  {
+    written += m_responseStream->Read(buffer + written, size - written);
+    if (m_responseStream->HasFailed())
+    {
+      CServiceBroker::GetLogging()
+          .GetLogger("CHTTPJsonRpcHandler")
+          ->error("Failed to serialize the JSON-RPC response");
+      return -1;
+    }
+  }
+
+  if (written < size && m_responseStream->IsComplete() && !m_responseSuffix.empty())
+  {
+    const size_t length = std::min(size - written, m_responseSuffix.size());
+    memcpy(buffer + written, m_responseSuffix.c_str(), length);
+    m_responseSuffix.erase(0, length);
+    written += length;
+  }
+
+  return static_cast<ssize_t>(written);
+}
+
 bool CHTTPJsonRpcHandler::appendPostData(const char *data, size_t size)
 {
   if (m_requestData.size() + size > MAX_HTTP_POST_SIZE)
@@ -11,7 +11,9 @@
 #include "interfaces/json-rpc/IClient.h"
 #include "interfaces/json-rpc/ITransportLayer.h"
 #include "network/httprequesthandler/IHTTPRequestHandler.h"
+#include "utils/JSONVariantWriter.h"
 
+#include <memory>
 #include <string>
 
 class CHTTPJsonRpcHandler : public IHTTPRequestHandler
@@ -27,6 +29,7 @@ public:
   MHD_RESULT HandleRequest() override;
 
   HttpResponseRanges GetResponseData() const override;
+  ssize_t ReadResponseStream(char* buffer, size_t size) override;
 
   int GetPriority() const override { return 5; }
 
@@ -41,6 +44,10 @@ private:
   std::string m_requestData;
   std::string m_responseData;
   CHttpResponseRange m_responseRange;
+  //! rest of a response which didn't fit into m_responseData, sent with chunked transfer encoding
+  std::unique_ptr<CJSONVariantStream> m_responseStream;
+  size_t m_responseOffset = 0; //!< part of m_responseData which has already been streamed
+  std::string m_responseSuffix; //!< sent after m_responseStream
 
   class CHTTPTransportLayer : public JSONRPC::ITransportLayer
   {
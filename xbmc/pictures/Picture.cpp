@@ -12,6 +12,7 @@
 #include "ServiceBroker.h"
 #include "URL.h"
 #include "filesystem/File.h"
+#include "guilib/DDSImage.h"
 #include "guilib/Texture.h"
 #include "guilib/imagefactory.h"
 #include "settings/AdvancedSettings.h"
@@ -22,6 +23,7 @@
 #include "utils/log.h"
 
 #include <algorithm>
+#include <cstring>
 
 extern "C" {
 #include <libswscale/swscale.h>
@@ -60,6 +62,24 @@ bool CPicture::CreateThumbnailFromSurface(const unsigned char *buffer, int width
 {
   CLog::Log(LOGDEBUG, "cached image '{}' size {}x{}", CURL::GetRedacted(thumbFile), width, height);
 
+  if (URIUtils::HasExtension(thumbFile, ".dds"))
+  {
+    // store the pixels as they are, so loading the image needs no decoding
+    CDDSImage image(width, height, XB_FMT_A8R8G8B8);
+    const unsigned int pitch = width * 4;
+    bool hasAlpha = false;
+    for (int y = 0; y < height; ++y)
+    {
+      const unsigned char* src = buffer + y * stride;
+      unsigned char* dst = image.GetData() + y * pitch;
+      std::memcpy(dst, src, pitch);
+      for (unsigned int x = 3; x < pitch && !hasAlpha; x += 4)
+        hasAlpha = src[x] != 0xff;
+    }
+    image.SetAlpha(hasAlpha);
+    return image.WriteFile(thumbFile);
+  }
+
   unsigned char *thumb = NULL;
   unsigned int thumbsize=0;
   IImage* pImage = ImageFactory::CreateLoader(thumbFile);
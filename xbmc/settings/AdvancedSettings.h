@@ -232,6 +232,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     CPictureScalingAlgorithm::Algorithm m_imageScalingAlgorithm;
     unsigned int
         m_imageQualityJpeg; ///< \brief the stored jpeg quality the lower the better (default: 4)
+    std::string m_imageCacheFormat; ///< \brief "dds" to cache images uncompressed, GPU ready
 
     int m_sambaclienttimeout;
     std::string m_sambadoscodepage;
@@ -266,6 +267,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_bVideoLibraryImportResumePoint{true};
 
     bool m_bVideoScannerIgnoreErrors;
+    int m_iVideoScannerPrefetchConnections; // concurrent directory fetches per host, 0 disables
     int m_iVideoLibraryDateAdded;
 
     std::set<std::string> m_vecTokens;
@@ -297,6 +299,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_curlDisableHTTP2;
 
     std::string m_caTrustFile;
+    int m_persistentCacheSize; ///< \brief MiB of seekable network files kept on disk, 0 disables
 
     bool m_minimizeToTray; /* win32 only */
     bool m_fullScreen;
@@ -339,6 +342,7 @@ class CAdvancedSettings : public ISettingCallback, public ISettingsHandler
     bool m_guiFrontToBackRendering{false};
     bool m_guiGeometryClear{true};
     bool m_guiAsyncTextureUpload{false};
+    int m_guiTextureUploadBudget{16384}; //!< KiB of large textures uploaded per frame, 0 = no limit
     bool m_guiVideoLayoutTransparent{false};
 
     unsigned int m_addonPackageFolderSize;
@@ -50,6 +50,7 @@ const std::string& CSkinSettings::GetString(int setting) const
 void CSkinSettings::SetString(int setting, const std::string &label)
 {
   g_SkinInfo->SetString(setting, label);
+  OnSettingChanged();
 }
 
 int CSkinSettings::TranslateBool(const std::string &setting)
@@ -70,11 +71,13 @@ int CSkinSettings::GetInt(int setting) const
 void CSkinSettings::SetBool(int setting, bool set)
 {
   g_SkinInfo->SetBool(setting, set);
+  OnSettingChanged();
 }
 
 void CSkinSettings::Reset(const std::string &setting)
 {
   g_SkinInfo->Reset(setting);
+  OnSettingChanged();
 }
 
 std::set<ADDON::CSkinSettingPtr> CSkinSettings::GetSettings() const
@@ -102,6 +105,13 @@ void CSkinSettings::Reset()
   infoMgr.GetInfoProviders().GetGUIControlsInfoProvider().ResetContainerMovingCache();
 }
 
+void CSkinSettings::OnSettingChanged()
+{
+  CGUIComponent* gui = CServiceBroker::GetGUI();
+  if (gui)
+    gui->GetInfoManager().GetInfoProviders().GetSkinInfoProvider().OnSkinSettingChanged();
+}
+
 bool CSkinSettings::Load(const TiXmlNode *settings)
 {
   if (settings == nullptr)
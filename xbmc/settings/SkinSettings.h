@@ -50,6 +50,11 @@ public:
   void Reset(const std::string &setting);
   void Reset();
 
+  /*! \brief Notify the GUI about a changed setting value
+   Needs to be called after changing the value of a setting returned by GetSetting()
+   */
+  void OnSettingChanged();
+
 protected:
   CSkinSettings();
   CSkinSettings(const CSkinSettings&) = delete;
@@ -69,6 +69,14 @@
   #endif
 #endif
 
+/* UTF-8 is converted from and to UTF-32 and wide strings without iconv, UTF-8-MAC sources
+   still need iconv for the normalization of decomposed characters */
+#if !defined(TARGET_DARWIN)
+  #define UTF8_SOURCE_IS_NATIVE 1
+#endif
+/* wide strings are UTF-16 or UTF-32 depending on the size of wchar_t */
+static_assert(sizeof(wchar_t) == 2 || sizeof(wchar_t) == 4, "unsupported size of wchar_t");
+
 #define NO_ICONV ((iconv_t)-1)
 
 enum SpecialCharset
@@ -283,6 +291,50 @@ public:
   template<class INPUT,class OUTPUT>
   static bool convert(iconv_t type, int multiplier, const INPUT& strSource, OUTPUT& strDest, bool failOnInvalidChar = false);
 
+  /* conversions handled by CUtf8Utils, they don't need a converter and its lock */
+  static bool isNativeConversion(StdConversionType convertType);
+  template<class INPUT, class OUTPUT>
+  static bool nativeConvert(const INPUT&, OUTPUT&, bool)
+  {
+    return false;
+  }
+  static bool nativeConvert(const std::string& strSource,
+                            std::u32string& strDest,
+                            bool failOnInvalidChar)
+  {
+    return CUtf8Utils::Utf8ToUtf32(strSource, strDest, failOnInvalidChar);
+  }
+  static bool nativeConvert(const std::string& strSource,
+                            std::wstring& strDest,
+                            bool failOnInvalidChar)
+  {
+    return CUtf8Utils::Utf8ToW(strSource, strDest, failOnInvalidChar);
+  }
+  static bool nativeConvert(const std::u32string& strSource,
+                            std::string& strDest,
+                            bool failOnInvalidChar)
+  {
+    return CUtf8Utils::Utf32ToUtf8(strSource, strDest, failOnInvalidChar);
+  }
+  static bool nativeConvert(const std::wstring& strSource,
+                            std::string& strDest,
+                            bool failOnInvalidChar)
+  {
+    return CUtf8Utils::WToUtf8(strSource, strDest, failOnInvalidChar);
+  }
+  static bool nativeConvert(const std::u32string& strSource,
+                            std::wstring& strDest,
+                            bool failOnInvalidChar)
+  {
+    return CUtf8Utils::Utf32ToW(strSource, strDest, failOnInvalidChar);
+  }
+  static bool nativeConvert(const std::wstring& strSource,
+                            std::u32string& strDest,
+                            bool failOnInvalidChar)
+  {
+    return CUtf8Utils::WToUtf32(strSource, strDest, failOnInvalidChar);
+  }
+
   static CConverterType m_stdConversion[NumberOfStdConversionTypes];
   static CCriticalSection m_critSectionFriBiDi;
 };
@@ -316,6 +368,25 @@ CConverterType CCharsetConverter::CInnerConverter::m_stdConversion[NumberOfStdCo
 
 CCriticalSection CCharsetConverter::CInnerConverter::m_critSectionFriBiDi;
 
+bool CCharsetConverter::CInnerConverter::isNativeConversion(StdConversionType convertType)
+{
+  switch (convertType)
+  {
+#ifdef UTF8_SOURCE_IS_NATIVE
+    case Utf8ToUtf32:
+    case Utf8toW:
+      return true;
+#endif
+    case Utf32ToUtf8:
+    case WtoUtf8:
+    case Utf32ToW:
+    case WToUtf32:
+      return true;
+    default:
+      return false;
+  }
+}
+
 template<class INPUT,class OUTPUT>
 bool CCharsetConverter::CInnerConverter::stdConvert(StdConversionType convertType, const INPUT& strSource, OUTPUT& strDest, bool failOnInvalidChar /*= false*/)
 {
@@ -326,6 +397,9 @@ bool CCharsetConverter::CInnerConverter::stdConvert(StdConversionType convertTyp
   if (convertType < 0 || convertType >= NumberOfStdConversionTypes)
     return false;
 
+  if (isNativeConversion(convertType))
+    return nativeConvert(strSource, strDest, failOnInvalidChar);
+
   CConverterType& convType = m_stdConversion[convertType];
   std::unique_lock<CCriticalSection> converterLock(convType);
 
@@ -702,12 +776,7 @@ std::string CCharsetConverter::utf32ToUtf8(const std::u32string& utf32StringSrc,
 
 bool CCharsetConverter::utf32ToW(const std::u32string& utf32StringSrc, std::wstring& wStringDst, bool failOnBadChar /*= true*/)
 {
-#ifdef WCHAR_IS_UCS_4
-  wStringDst.assign((const wchar_t*)utf32StringSrc.c_str(), utf32StringSrc.length());
-  return true;
-#else // !WCHAR_IS_UCS_4
   return CInnerConverter::stdConvert(Utf32ToW, utf32StringSrc, wStringDst, failOnBadChar);
-#endif // !WCHAR_IS_UCS_4
 }
 
 bool CCharsetConverter::utf32logicalToVisualBiDi(const std::u32string& logicalStringSrc,
@@ -723,10 +792,8 @@ bool CCharsetConverter::utf32logicalToVisualBiDi(const std::u32string& logicalSt
 
 bool CCharsetConverter::wToUtf32(const std::wstring& wStringSrc, std::u32string& utf32StringDst, bool failOnBadChar /*= true*/)
 {
-#ifdef WCHAR_IS_UCS_4
   /* UCS-4 is almost equal to UTF-32, but UTF-32 has strict limits on possible values, while UCS-4 is usually unchecked.
    * With this "conversion" we ensure that output will be valid UTF-32 string. */
-#endif
   return CInnerConverter::stdConvert(WToUtf32, wStringSrc, utf32StringDst, failOnBadChar);
 }
 
@@ -10,11 +10,16 @@
 
 #include "dbwrappers/dataset.h"
 #include "music/MusicDatabase.h"
+#include "utils/Base64.h"
+#include "utils/JSONVariantParser.h"
+#include "utils/JSONVariantWriter.h"
+#include "utils/SortUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 #include "video/VideoDatabase.h"
 
+#include <charconv>
 #include <sstream>
 
 MediaType DatabaseUtils::MediaTypeFromVideoContentType(VideoDbContentType videoContentType)
@@ -458,6 +463,7 @@ bool DatabaseUtils::GetDatabaseResults(const MediaType &mediaType, const FieldLi
   for (FieldList::const_iterator it = fields.begin(); it != fields.end(); ++it)
     fieldIndexLookup.push_back(GetFieldIndex(*it, mediaType));
 
+  dbiplus::field_value fieldValue;
   results.reserve(resultSet.records.size() + offset);
   for (unsigned int index = 0; index < resultSet.records.size(); index++)
   {
@@ -473,7 +479,8 @@ bool DatabaseUtils::GetDatabaseResults(const MediaType &mediaType, const FieldLi
 
       std::pair<Field, CVariant> value;
       value.first = *it;
-      if (!GetFieldValue(resultSet.records[index]->at(fieldIndex), value.second))
+      resultSet.records.get_value(index, fieldIndex, fieldValue);
+      if (!GetFieldValue(fieldValue, value.second))
         CLog::Log(LOGWARNING, "GetDatabaseResults: unable to retrieve value of field {}",
                   resultSet.record_header[fieldIndex].name);
 
@@ -563,6 +570,103 @@ size_t DatabaseUtils::GetLimitCount(int end, int start)
   return 0;
 }
 
+std::string DatabaseUtils::BuildKeysetCondition(const std::vector<std::string>& keys,
+                                                bool descending,
+                                                const CVariant& values,
+                                                std::vector<dbiplus::field_value>& params)
+{
+  if (keys.empty() || !values.isArray() || values.size() != keys.size())
+    return "";
+
+  // (k0 > v0) OR (k0 = v0 AND ((k1 > v1) OR (k1 = v1 AND (k2 > v2)))), built from the last key
+  const char* op = descending ? " < ?" : " > ?";
+  std::vector<dbiplus::field_value> keyParams;
+  std::string condition;
+  for (size_t i = keys.size(); i-- > 0;)
+  {
+    dbiplus::field_value value;
+    const CVariant& key = values[static_cast<unsigned int>(i)];
+    if (key.isInteger() || key.isUnsignedInteger() || key.isBoolean())
+      value.set_asInt64(key.asInteger());
+    else if (key.isDouble())
+      value.set_asDouble(key.asDouble());
+    else if (key.isString())
+      value.set_asString(key.asString());
+    else
+      return "";
+
+    if (condition.empty())
+    {
+      condition = keys[i] + op;
+      keyParams.insert(keyParams.begin(), value);
+    }
+    else
+    {
+      condition = "(" + keys[i] + op + " OR (" + keys[i] + " = ? AND (" + condition + ")))";
+      keyParams.insert(keyParams.begin(), {value, value});
+    }
+  }
+
+  params.insert(params.end(), keyParams.begin(), keyParams.end());
+  return condition;
+}
+
+std::string DatabaseUtils::EncodeKeysetCursor(const SortDescription& sorting,
+                                              const CVariant& values)
+{
+  CVariant cursor(CVariant::VariantTypeObject);
+  cursor["sort"] = static_cast<int>(sorting.sortBy);
+  cursor["order"] = static_cast<int>(sorting.sortOrder);
+  cursor["attributes"] = static_cast<int>(sorting.sortAttributes);
+  cursor["keys"] = CVariant(CVariant::VariantTypeArray);
+  for (auto it = values.begin_array(); it != values.end_array(); ++it)
+  {
+    // the JSON parser doesn't restore every double exactly, but the keyset has to match
+    if (it->isDouble())
+    {
+      CVariant value(CVariant::VariantTypeObject);
+      value["double"] = StringUtils::Format("{}", it->asDouble());
+      cursor["keys"].push_back(value);
+    }
+    else
+      cursor["keys"].push_back(*it);
+  }
+
+  std::string json;
+  if (!CJSONVariantWriter::Write(cursor, json, true))
+    return "";
+  return Base64::Encode(json);
+}
+
+bool DatabaseUtils::DecodeKeysetCursor(const SortDescription& sorting, CVariant& values)
+{
+  if (sorting.limitCursor.empty())
+    return false;
+
+  CVariant cursor;
+  if (!CJSONVariantParser::Parse(Base64::Decode(sorting.limitCursor), cursor) ||
+      !cursor.isObject() || cursor["sort"].asInteger() != sorting.sortBy ||
+      cursor["order"].asInteger() != sorting.sortOrder ||
+      cursor["attributes"].asInteger() != sorting.sortAttributes || !cursor["keys"].isArray())
+    return false;
+
+  values = CVariant(CVariant::VariantTypeArray);
+  for (auto it = cursor["keys"].begin_array(); it != cursor["keys"].end_array(); ++it)
+  {
+    if (it->isObject())
+    {
+      const std::string str = (*it)["double"].asString();
+      double value = 0.0;
+      if (std::from_chars(str.data(), str.data() + str.size(), value).ec != std::errc())
+        return false;
+      values.push_back(value);
+    }
+    else
+      values.push_back(*it);
+  }
+  return true;
+}
+
 int DatabaseUtils::GetField(Field field, const MediaType &mediaType, bool asIndex)
 {
   if (field == FieldNone || mediaType == MediaTypeNone)
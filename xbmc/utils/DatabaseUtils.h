@@ -18,6 +18,7 @@
 
 class CVariant;
 enum class VideoDbContentType;
+struct SortDescription;
 
 namespace dbiplus
 {
@@ -183,6 +184,33 @@ public:
   static std::string BuildLimitClauseOnly(int end, int start = 0);
   static size_t GetLimitCount(int end, int start);
 
+  /*!
+   \brief Build the condition of a keyset paginated query
+   \param keys SQL expressions the query is ordered by, the last one has to be unique per row
+   \param descending whether the keys are sorted in descending order
+   \param values values of the keys in the last row of the previous page
+   \param params receives the values for the ? placeholders of the condition
+   \return condition selecting the rows that follow the given values, empty if values doesn't
+           match the keys
+   */
+  static std::string BuildKeysetCondition(const std::vector<std::string>& keys,
+                                          bool descending,
+                                          const CVariant& values,
+                                          std::vector<dbiplus::field_value>& params);
+
+  /*!
+   \brief Opaque cursor that lets a client continue a paged listing after its last item
+   \param sorting sort description of the listing, a cursor is only valid for the same sorting
+   \param values values of the sort keys in the last row of the page
+   */
+  static std::string EncodeKeysetCursor(const SortDescription& sorting, const CVariant& values);
+
+  /*!
+   \brief Get the key values of sorting.limitCursor
+   \return false if there's no cursor or it was created for a different sorting
+   */
+  static bool DecodeKeysetCursor(const SortDescription& sorting, CVariant& values);
+
 private:
   static int GetField(Field field, const MediaType &mediaType, bool asIndex);
 };
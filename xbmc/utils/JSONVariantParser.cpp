@@ -118,7 +118,7 @@ bool CJSONVariantParserHandler::StartObject()
 
 bool CJSONVariantParserHandler::Key(const char* str, rapidjson::SizeType length, bool copy)
 {
-  m_key = std::string(str, 0, length);
+  m_key.assign(str, length);
 
   return true;
 }
@@ -150,8 +150,9 @@ void CJSONVariantParserHandler::PushObject(CVariant variant)
 
   if (m_status == PARSE_STATUS::Object)
   {
-    (*m_parse.back())[m_key] = std::move(variant);
-    m_parse.push_back(&((*m_parse.back())[m_key]));
+    CVariant& member = (*m_parse.back())[m_key];
+    member = std::move(variant);
+    m_parse.push_back(&member);
   }
   else if (m_status == PARSE_STATUS::Array)
   {
@@ -191,7 +192,7 @@ void CJSONVariantParserHandler::PopObject()
   }
   else
   {
-    m_parsedObject = *variant;
+    m_parsedObject = std::move(*variant);
     m_status = PARSE_STATUS::Variable;
   }
 }
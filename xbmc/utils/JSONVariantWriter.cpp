@@ -10,6 +10,9 @@
 
 #include "utils/Variant.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
@@ -52,7 +55,8 @@ bool InternalWrite(TWriter& writer, const CVariant &value)
 
     for (CVariant::const_iterator_map itr = value.begin_map(); itr != value.end_map(); ++itr)
     {
-      if (!writer.Key(itr->first.c_str()) ||
+      const std::string& key = itr->first;
+      if (!writer.Key(key.c_str(), static_cast<rapidjson::SizeType>(key.size())) ||
         !InternalWrite(writer, itr->second))
         return false;
     }
@@ -87,6 +91,164 @@ bool CJSONVariantWriter::Write(const CVariant &value, std::string& output, bool
       return false;
   }
 
-  output = stringBuffer.GetString();
+  output.assign(stringBuffer.GetString(), stringBuffer.GetSize());
   return true;
 }
+
+class CJSONVariantStream::IWriter
+{
+public:
+  virtual ~IWriter() = default;
+
+  virtual bool Scalar(const CVariant& value) = 0;
+  virtual bool StartArray() = 0;
+  virtual bool EndArray(size_t size) = 0;
+  virtual bool StartObject() = 0;
+  virtual bool Key(const std::string& key) = 0;
+  virtual bool EndObject(size_t size) = 0;
+  virtual bool IsComplete() const = 0;
+
+  rapidjson::StringBuffer m_buffer;
+};
+
+template<class TWriter>
+class CJSONVariantStream::CWriter : public CJSONVariantStream::IWriter
+{
+public:
+  CWriter() : m_writer(m_buffer) {}
+
+  bool Scalar(const CVariant& value) override { return InternalWrite(m_writer, value); }
+  bool StartArray() override { return m_writer.StartArray(); }
+  bool EndArray(size_t size) override
+  {
+    return m_writer.EndArray(static_cast<rapidjson::SizeType>(size));
+  }
+  bool StartObject() override { return m_writer.StartObject(); }
+  bool Key(const std::string& key) override
+  {
+    return m_writer.Key(key.c_str(), static_cast<rapidjson::SizeType>(key.size()));
+  }
+  bool EndObject(size_t size) override
+  {
+    return m_writer.EndObject(static_cast<rapidjson::SizeType>(size));
+  }
+  bool IsComplete() const override { return m_writer.IsComplete(); }
+
+  TWriter m_writer;
+};
+
+struct CJSONVariantStream::CFrame
+{
+  explicit CFrame(CVariant& value) : value(&value) {}
+
+  CVariant* value;
+  bool started = false;
+  CVariant::iterator_array element;
+  CVariant::iterator_map member;
+};
+
+CJSONVariantStream::CJSONVariantStream(CVariant value, bool compact)
+  : m_value(std::make_unique<CVariant>(std::move(value)))
+{
+  if (compact)
+    m_writer = std::make_unique<CWriter<rapidjson::Writer<rapidjson::StringBuffer>>>();
+  else
+  {
+    auto writer = std::make_unique<CWriter<rapidjson::PrettyWriter<rapidjson::StringBuffer>>>();
+    writer->m_writer.SetIndent('\t', 1);
+    m_writer = std::move(writer);
+  }
+
+  m_stack.emplace_back(*m_value);
+}
+
+CJSONVariantStream::~CJSONVariantStream() = default;
+
+size_t CJSONVariantStream::Read(char* buffer, size_t size)
+{
+  rapidjson::StringBuffer& output = m_writer->m_buffer;
+  size_t read = 0;
+  while (read < size && !m_failed)
+  {
+    if (m_offset == output.GetSize())
+    {
+      // serialize more of the value until the rest of the buffer can be filled
+      output.Clear();
+      m_offset = 0;
+      while (output.GetSize() < size - read && !m_stack.empty())
+      {
+        if (!Step())
+        {
+          // keep what has been copied to the buffer already
+          m_failed = true;
+          return read;
+        }
+      }
+      if (output.GetSize() == 0)
+        break;
+    }
+
+    const size_t length = std::min(size - read, output.GetSize() - m_offset);
+    std::memcpy(buffer + read, output.GetString() + m_offset, length);
+    m_offset += length;
+    read += length;
+  }
+
+  return read;
+}
+
+bool CJSONVariantStream::IsComplete() const
+{
+  return !m_failed && m_stack.empty() && m_offset == m_writer->m_buffer.GetSize();
+}
+
+bool CJSONVariantStream::Step()
+{
+  CFrame& frame = m_stack.back();
+  CVariant& value = *frame.value;
+
+  if (value.isArray())
+  {
+    if (!frame.started)
+    {
+      frame.started = true;
+      frame.element = value.begin_array();
+      return m_writer->StartArray();
+    }
+    if (frame.element != value.end_array())
+    {
+      CVariant& element = *frame.element++;
+      m_stack.emplace_back(element);
+      return true;
+    }
+    if (!m_writer->EndArray(value.size()))
+      return false;
+  }
+  else if (value.isObject())
+  {
+    if (!frame.started)
+    {
+      frame.started = true;
+      frame.member = value.begin_map();
+      return m_writer->StartObject();
+    }
+    if (frame.member != value.end_map())
+    {
+      const auto member = *frame.member++;
+      if (!m_writer->Key(member.first))
+        return false;
+      m_stack.emplace_back(member.second);
+      return true;
+    }
+    if (!m_writer->EndObject(value.size()))
+      return false;
+  }
+  else if (!m_writer->Scalar(value))
+    return false;
+
+  // the value has been written completely and isn't needed anymore
+  m_stack.pop_back();
+  value = CVariant();
+
+  return !m_stack.empty() || m_writer->IsComplete();
+}
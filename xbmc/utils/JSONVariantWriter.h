@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
+#include <vector>
 
 class CVariant;
 
@@ -19,3 +21,50 @@ public:
 
   static bool Write(const CVariant &value, std::string& output, bool compact);
 };
+
+/*!
+ \brief Serializes a CVariant piece by piece while it is being sent
+
+ Instead of writing the whole value into one string first, every call to Read() serializes just
+ enough of it to fill the given buffer. The stream owns the value and releases every array
+ element and object member as soon as it has been written, so the memory used by a large
+ response shrinks while it is sent. The output is the same as the one of
+ CJSONVariantWriter::Write().
+ */
+class CJSONVariantStream
+{
+public:
+  CJSONVariantStream(CVariant value, bool compact);
+  ~CJSONVariantStream();
+
+  /*!
+   \brief Writes the next part of the serialized value to the given buffer
+   \return number of bytes written, 0 once the whole value has been written. After an error the
+   bytes written before it are returned and HasFailed() is set, the output is incomplete.
+   */
+  size_t Read(char* buffer, size_t size);
+
+  /*! \brief Whether the whole value has been serialized and read */
+  bool IsComplete() const;
+
+  /*! \brief Whether the value can't be serialized, e.g. because it contains a NaN */
+  bool HasFailed() const { return m_failed; }
+
+private:
+  CJSONVariantStream(const CJSONVariantStream&) = delete;
+  CJSONVariantStream& operator=(const CJSONVariantStream&) = delete;
+
+  class IWriter;
+  template<class TWriter>
+  class CWriter;
+  struct CFrame;
+
+  bool Step();
+
+  std::unique_ptr<CVariant> m_value;
+  std::unique_ptr<IWriter> m_writer;
+  //! values which have been started but not finished yet, the innermost one last
+  std::vector<CFrame> m_stack;
+  size_t m_offset = 0; //!< position of the unread output of m_writer
+  bool m_failed = false;
+};
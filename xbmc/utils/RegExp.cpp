@@ -215,28 +215,24 @@ CRegExp::CRegExp(const CRegExp& re)
 
 CRegExp& CRegExp::operator=(const CRegExp& re)
 {
-  size_t size;
+  if (this == &re)
+    return *this;
+
   Cleanup();
   m_jitCompiled = false;
   m_pattern = re.m_pattern;
   if (re.m_re)
   {
-    if (pcre2_pattern_info(re.m_re, PCRE2_INFO_SIZE, &size) >= 0)
-    {
-      if ((m_re = pcre2_code_copy(re.m_re)))
-      {
-        if (re.m_ctxt)
-          m_ctxt = pcre2_match_context_copy(re.m_ctxt);
-        m_iOvector = re.m_iOvector;
-        m_offset = re.m_offset;
-        m_iMatchCount = re.m_iMatchCount;
-        m_bMatched = re.m_bMatched;
-        m_subject = re.m_subject;
-        m_iOptions = re.m_iOptions;
-      }
-      else
-        CLog::Log(LOGFATAL, "{}: Failed to allocate memory", __FUNCTION__);
-    }
+    // compiled code is read-only while matching, only the match context and data are per object
+    m_code = re.m_code;
+    m_re = m_code.get();
+    m_jitCompiled = re.m_jitCompiled;
+    m_iOvector = re.m_iOvector;
+    m_offset = re.m_offset;
+    m_iMatchCount = re.m_iMatchCount;
+    m_bMatched = re.m_bMatched;
+    m_subject = re.m_subject;
+    m_iOptions = re.m_iOptions;
   }
   return *this;
 }
@@ -281,6 +277,7 @@ bool CRegExp::RegComp(const char *re, studyMode study /*= NoStudy*/)
     return false;
   }
 
+  m_code.reset(m_re, pcre2_code_free);
   m_pattern = re;
 
   if (study)
@@ -434,6 +431,27 @@ int CRegExp::GetCaptureTotal() const
   return c;
 }
 
+bool CRegExp::IsMatch(const std::string& str) const
+{
+  if (!m_re)
+    return false;
+
+  // one match data per thread, the offsets aren't needed
+  static thread_local std::unique_ptr<pcre2_match_data, decltype(&pcre2_match_data_free)>
+      matchData(pcre2_match_data_create(1, nullptr), pcre2_match_data_free);
+  if (!matchData)
+    return false;
+
+  const int rc = pcre2_match(m_re, reinterpret_cast<PCRE2_SPTR>(str.c_str()), str.length(), 0, 0,
+                             matchData.get(), nullptr);
+  if (rc != PCRE2_ERROR_JIT_STACKLIMIT)
+    return rc >= 0;
+
+  // the default JIT stack is too small, use a copy with its own stack
+  CRegExp copy(*this);
+  return copy.RegFind(str) >= 0;
+}
+
 std::string CRegExp::GetReplaceString(const std::string& sReplaceExp) const
 {
   if (!m_bMatched || sReplaceExp.empty())
@@ -533,11 +551,8 @@ void CRegExp::DumpOvector(int iLog /* = LOGDEBUG */)
 
 void CRegExp::Cleanup()
 {
-  if (m_re)
-  {
-    pcre2_code_free(m_re);
-    m_re = nullptr;
-  }
+  m_code.reset();
+  m_re = nullptr;
 
   if (m_ctxt)
   {
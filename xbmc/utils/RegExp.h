@@ -10,6 +10,7 @@
 
 //! @todo - move to std::regex (after switching to gcc 4.9 or higher) and get rid of CRegExp
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -52,6 +53,10 @@ public:
    */
   CRegExp(bool caseless, utf8Mode utf8, const char *re, studyMode study = NoStudy);
 
+  /**
+   * Copy a CRegExp object, the compiled expression (including the JIT-compiled code) is shared
+   * and not compiled again. Copies can be used from different threads.
+   */
   CRegExp(const CRegExp& re);
   ~CRegExp();
 
@@ -93,6 +98,13 @@ public:
    */
   int RegFind(const std::string& str, unsigned int startoffset = 0, int maxNumberOfCharsToTest = -1)
   { return PrivateRegFind(str.length(), str.c_str(), startoffset, maxNumberOfCharsToTest); }
+  /**
+   * Check whether the regular expression matches a string without storing the match
+   * @note Doesn't change the object, so it can be called from several threads at the same time
+   * @param str         The string to match against regular expression
+   * @return true if the expression matches, false in case of error or no match
+   */
+  bool IsMatch(const std::string& str) const;
   std::string GetReplaceString(const std::string& sReplaceExp) const;
   int GetFindLen() const
   {
@@ -131,6 +143,7 @@ private:
   inline bool IsValidSubNumber(int iSub) const;
 
   pcre2_code* m_re;
+  std::shared_ptr<pcre2_code> m_code; // owns m_re, shared by the copies of this object
   pcre2_match_context* m_ctxt;
   static const int OVECCOUNT=(m_MaxNumOfBackrefrences + 1) * 3;
   unsigned int m_offset;
@@ -0,0 +1,85 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "RegExpSet.h"
+
+#include "threads/CriticalSection.h"
+#include "utils/log.h"
+
+#include <algorithm>
+#include <list>
+#include <mutex>
+
+namespace
+{
+// the settings use a handful of lists, a few more are kept for the lists of addons and skins
+constexpr size_t MAX_CACHED_SETS = 16;
+
+CCriticalSection cacheSection;
+std::list<std::shared_ptr<const CRegExpSet>> cache; // most recently used first
+} // namespace
+
+CRegExpSet::CRegExpSet(const std::vector<std::string>& regexps,
+                       bool caseless,
+                       CRegExp::utf8Mode utf8)
+  : m_patterns(regexps), m_caseless(caseless), m_utf8(utf8)
+{
+  for (size_t i = 0; i < regexps.size(); ++i)
+  {
+    CRegExp regexp(caseless, utf8);
+    if (!regexp.RegComp(regexps[i], CRegExp::StudyWithJitComp))
+    {
+      CLog::Log(LOGERROR, "{}: Invalid RegExp:'{}'", __FUNCTION__, regexps[i]);
+      continue;
+    }
+    m_regexps.emplace_back(static_cast<int>(i), std::move(regexp));
+  }
+}
+
+std::shared_ptr<const CRegExpSet> CRegExpSet::Get(const std::vector<std::string>& regexps,
+                                                  bool caseless,
+                                                  CRegExp::utf8Mode utf8)
+{
+  std::unique_lock<CCriticalSection> lock(cacheSection);
+  const auto it = std::find_if(cache.begin(), cache.end(),
+                               [&](const std::shared_ptr<const CRegExpSet>& set)
+                               {
+                                 return set->m_caseless == caseless && set->m_utf8 == utf8 &&
+                                        set->m_patterns == regexps;
+                               });
+  if (it != cache.end())
+  {
+    cache.splice(cache.begin(), cache, it);
+    return cache.front();
+  }
+
+  // compiled under the lock, so that scans running in parallel don't compile the same list twice
+  cache.emplace_front(std::make_shared<const CRegExpSet>(regexps, caseless, utf8));
+  if (cache.size() > MAX_CACHED_SETS)
+    cache.pop_back();
+  return cache.front();
+}
+
+int CRegExpSet::Find(const std::string& str,
+                     CRegExp* match /* = nullptr */,
+                     int first /* = 0 */) const
+{
+  for (const auto& [index, regexp] : m_regexps)
+  {
+    if (index < first || !regexp.IsMatch(str))
+      continue;
+
+    if (match)
+    {
+      *match = regexp;
+      match->RegFind(str);
+    }
+    return index;
+  }
+  return -1;
+}
@@ -0,0 +1,60 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "utils/RegExp.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/*!
+ \brief A list of regular expressions compiled once, to match many strings against
+
+ Used for the expression lists of the advanced settings (exclude and episode expressions), which
+ are matched against every file of a scan. The expressions are JIT-compiled if possible. A set is
+ immutable, so it can be shared and used from several threads.
+ */
+class CRegExpSet
+{
+public:
+  /*!
+   \brief Compile a list of expressions, invalid expressions are logged and never match
+   \param regexps the expressions
+   \param caseless match case insensitive
+   \param utf8 control UTF-8 processing
+   */
+  CRegExpSet(const std::vector<std::string>& regexps, bool caseless, CRegExp::utf8Mode utf8);
+
+  /*!
+   \brief Get the set of a list of expressions, the sets of the last few lists used are kept
+   \sa CRegExpSet()
+   */
+  static std::shared_ptr<const CRegExpSet> Get(const std::vector<std::string>& regexps,
+                                               bool caseless = true,
+                                               CRegExp::utf8Mode utf8 = CRegExp::autoUtf8);
+
+  /*!
+   \brief Find the first expression matching a string
+   \param str the string to match
+   \param match (optional) set to the matching expression, to access the captures
+   \param first index of the first expression to try
+   \return index of the matching expression in the list or -1 if no expression matched
+   */
+  int Find(const std::string& str, CRegExp* match = nullptr, int first = 0) const;
+
+  const std::string& GetPattern(int index) const { return m_patterns[index]; }
+  bool IsEmpty() const { return m_regexps.empty(); }
+
+private:
+  std::vector<std::string> m_patterns;
+  bool m_caseless;
+  CRegExp::utf8Mode m_utf8;
+  std::vector<std::pair<int, CRegExp>> m_regexps; //!< compiled expressions with their index
+};
@@ -16,7 +16,11 @@
 #include "utils/Variant.h"
 
 #include <algorithm>
+#include <future>
 #include <inttypes.h>
+#include <numeric>
+#include <string_view>
+#include <thread>
 
 std::string ArrayToString(SortAttribute attributes, const CVariant &variant, const std::string &separator = " / ")
 {
@@ -504,132 +508,174 @@ std::string ByBPM(SortAttribute attributes, const SortItem& values)
                              ByLabel(attributes, values));
 }
 
-bool preliminarySort(const SortItem &left, const SortItem &right, bool handleFolder, bool &result, std::wstring &labelLeft, std::wstring &labelRight)
+namespace
 {
-  // make sure both items have the necessary data to do the sorting
-  SortItem::const_iterator itLeftSort, itRightSort;
-  if ((itLeftSort = left.find(FieldSort)) == left.end())
+// number of items per thread from which large inputs are sorted on several threads
+constexpr size_t PARALLEL_SORT_CHUNK_SIZE = 8192;
+
+SortItem& ToSortItem(SortItem& item)
+{
+  return item;
+}
+
+SortItem& ToSortItem(const SortItemPtr& item)
+{
+  return *item;
+}
+
+/*!
+ \brief Sort keys of a list of items, stored column by column
+
+ Everything a comparison needs is extracted from the items once, including the collation key of
+ the sort label, so that sorting only compares indices into the columns instead of looking up the
+ fields of both items and converting their labels for every comparison.
+ */
+class CSortColumns
+{
+public:
+  CSortColumns(size_t size, SortOrder sortOrder, SortAttribute attributes)
+    : m_descending(sortOrder == SortOrderDescending),
+      m_handleFolders(!(attributes & SortAttributeIgnoreFolders))
   {
-    result = false;
-    return true;
+    m_special.reserve(size);
+    m_folder.reserve(size);
+    m_keyOffsets.reserve(size + 1);
+    m_keyOffsets.push_back(0);
   }
-  if ((itRightSort = right.find(FieldSort)) == right.end())
+
+  void Add(const SortItem& item, const std::wstring& label)
   {
-    result = true;
-    return true;
+    SortSpecial special = SortSpecialNone;
+    auto it = item.find(FieldSortSpecial);
+    if (it != item.end() && it->second.asInteger() <= (int64_t)SortSpecialOnBottom)
+      special = (SortSpecial)it->second.asInteger();
+    m_special.push_back(special);
+
+    it = item.find(FieldFolder);
+    m_folder.push_back(it == item.end() ? FOLDER_UNKNOWN : it->second.asBoolean());
+
+    StringUtils::AppendAlphaNumericSortKey(label.c_str(), m_keys);
+    m_keyOffsets.push_back(m_keys.size());
   }
 
-  // look at special sorting behaviour
-  SortItem::const_iterator itLeft, itRight;
-  SortSpecial leftSortSpecial = SortSpecialNone;
-  SortSpecial rightSortSpecial = SortSpecialNone;
-  if ((itLeft = left.find(FieldSortSpecial)) != left.end() && itLeft->second.asInteger() <= (int64_t)SortSpecialOnBottom)
-    leftSortSpecial = (SortSpecial)itLeft->second.asInteger();
-  if ((itRight = right.find(FieldSortSpecial)) != right.end() && itRight->second.asInteger() <= (int64_t)SortSpecialOnBottom)
-    rightSortSpecial = (SortSpecial)itRight->second.asInteger();
-
-  // one has a special sort
-  if (leftSortSpecial != rightSortSpecial)
+  /*! \brief Get the indices of the items in sorted order, equal items keep their order */
+  std::vector<size_t> GetOrder() const
   {
-    // left should be sorted on top
-    // or right should be sorted on bottom
-    // => left is sorted above right
-    if (leftSortSpecial == SortSpecialOnTop ||
-        rightSortSpecial == SortSpecialOnBottom)
+    std::vector<size_t> order(m_special.size());
+    std::iota(order.begin(), order.end(), 0);
+    const auto less = [this](size_t left, size_t right) { return Less(left, right); };
+
+    const size_t chunks = std::min<size_t>(std::thread::hardware_concurrency(),
+                                           order.size() / PARALLEL_SORT_CHUNK_SIZE);
+    if (chunks < 2)
     {
-      result = true;
-      return true;
+      std::stable_sort(order.begin(), order.end(), less);
+      return order;
     }
 
-    // otherwise right is sorted above left
-    result = false;
-    return true;
-  }
-  // both have either sort on top or sort on bottom -> leave as-is
-  else if (leftSortSpecial != SortSpecialNone)
-  {
-    result = false;
-    return true;
-  }
+    std::vector<size_t> bounds;
+    for (size_t chunk = 0; chunk <= chunks; chunk++)
+      bounds.push_back(order.size() * chunk / chunks);
 
-  if (handleFolder)
-  {
-    itLeft = left.find(FieldFolder);
-    itRight = right.find(FieldFolder);
-    if (itLeft != left.end() && itRight != right.end() &&
-        itLeft->second.asBoolean() != itRight->second.asBoolean())
+    std::vector<std::future<void>> sorts;
+    for (size_t chunk = 1; chunk < chunks; chunk++)
     {
-      result = itLeft->second.asBoolean();
-      return true;
+      sorts.emplace_back(std::async(std::launch::async, [&order, &bounds, &less, chunk]() {
+        std::stable_sort(order.begin() + bounds[chunk], order.begin() + bounds[chunk + 1], less);
+      }));
     }
-  }
+    std::stable_sort(order.begin(), order.begin() + bounds[1], less);
+    for (auto& sort : sorts)
+      sort.wait();
 
-  labelLeft = itLeftSort->second.asWideString();
-  labelRight = itRightSort->second.asWideString();
-
-  return false;
-}
+    // merging neighbouring chunks prefers the left one on ties, so the result is still stable
+    for (size_t width = 1; width < chunks; width *= 2)
+    {
+      for (size_t chunk = 0; chunk + width < chunks; chunk += 2 * width)
+        std::inplace_merge(order.begin() + bounds[chunk], order.begin() + bounds[chunk + width],
+                           order.begin() + bounds[std::min(chunk + 2 * width, chunks)], less);
+    }
+    return order;
+  }
 
-bool SorterAscending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, true, result, labelLeft, labelRight))
-    return result;
+private:
+  static constexpr int8_t FOLDER_UNKNOWN = -1;
 
-  return StringUtils::AlphaNumericCompare(labelLeft.c_str(), labelRight.c_str()) < 0;
-}
+  std::u32string_view GetKey(size_t index) const
+  {
+    return std::u32string_view(m_keys).substr(m_keyOffsets[index],
+                                              m_keyOffsets[index + 1] - m_keyOffsets[index]);
+  }
 
-bool SorterDescending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, true, result, labelLeft, labelRight))
-    return result;
+  bool Less(size_t left, size_t right) const
+  {
+    // one has a special sort
+    if (m_special[left] != m_special[right])
+    {
+      // left should be sorted on top or right should be sorted on bottom
+      return m_special[left] == SortSpecialOnTop || m_special[right] == SortSpecialOnBottom;
+    }
+    // both have either sort on top or sort on bottom -> leave as-is
+    if (m_special[left] != SortSpecialNone)
+      return false;
 
-  return StringUtils::AlphaNumericCompare(labelLeft.c_str(), labelRight.c_str()) > 0;
-}
+    if (m_handleFolders && m_folder[left] != FOLDER_UNKNOWN && m_folder[right] != FOLDER_UNKNOWN &&
+        m_folder[left] != m_folder[right])
+      return m_folder[left] != 0;
 
-bool SorterIgnoreFoldersAscending(const SortItem &left, const SortItem &right)
-{
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, false, result, labelLeft, labelRight))
-    return result;
+    const int64_t result = StringUtils::AlphaNumericCompareKeys(GetKey(left), GetKey(right));
+    return m_descending ? result > 0 : result < 0;
+  }
 
-  return StringUtils::AlphaNumericCompare(labelLeft.c_str(), labelRight.c_str()) < 0;
-}
+  const bool m_descending;
+  const bool m_handleFolders;
+  std::vector<SortSpecial> m_special;
+  std::vector<int8_t> m_folder; //!< FOLDER_UNKNOWN if the item doesn't say
+  std::u32string m_keys; //!< collation keys of the sort labels of all items
+  std::vector<size_t> m_keyOffsets;
+};
 
-bool SorterIgnoreFoldersDescending(const SortItem &left, const SortItem &right)
+template<typename Items>
+void SortByColumns(SortUtils::SortPreparator preparator,
+                   const Fields& sortingFields,
+                   SortOrder sortOrder,
+                   SortAttribute attributes,
+                   Items& items)
 {
-  bool result;
-  std::wstring labelLeft, labelRight;
-  if (preliminarySort(left, right, false, result, labelLeft, labelRight))
-    return result;
-
-  return StringUtils::AlphaNumericCompare(labelLeft.c_str(), labelRight.c_str()) > 0;
-}
+  CSortColumns columns(items.size(), sortOrder, attributes);
+  for (auto& entry : items)
+  {
+    SortItem& item = ToSortItem(entry);
 
-bool SorterIndirectAscending(const SortItemPtr &left, const SortItemPtr &right)
-{
-  return SorterAscending(*left, *right);
-}
+    // add all fields to the item that are required for sorting if they are currently missing
+    for (const auto& field : sortingFields)
+    {
+      if (item.find(field) == item.end())
+        item.insert(std::pair<Field, CVariant>(field, CVariant::ConstNullVariant));
+    }
 
-bool SorterIndirectDescending(const SortItemPtr &left, const SortItemPtr &right)
-{
-  return SorterDescending(*left, *right);
-}
+    // Prepare the string used for sorting and store it under FieldSort
+    const auto it = item.find(FieldSort);
+    if (it != item.end())
+    {
+      columns.Add(item, it->second.asWideString());
+      continue;
+    }
 
-bool SorterIndirectIgnoreFoldersAscending(const SortItemPtr &left, const SortItemPtr &right)
-{
-  return SorterIgnoreFoldersAscending(*left, *right);
-}
+    std::wstring sortLabel;
+    g_charsetConverter.utf8ToW(preparator(attributes, item), sortLabel, false);
+    columns.Add(item, sortLabel);
+    item.insert(std::pair<Field, CVariant>(FieldSort, CVariant(std::move(sortLabel))));
+  }
 
-bool SorterIndirectIgnoreFoldersDescending(const SortItemPtr &left, const SortItemPtr &right)
-{
-  return SorterIgnoreFoldersDescending(*left, *right);
+  const std::vector<size_t> order = columns.GetOrder();
+  Items sorted;
+  sorted.reserve(items.size());
+  for (const size_t index : order)
+    sorted.push_back(std::move(items[index]));
+  items.swap(sorted);
 }
-
+} // namespace
 // clang-format off
 std::map<SortBy, SortUtils::SortPreparator> fillPreparators()
 {
@@ -968,6 +1014,45 @@ void SortUtils::GetFieldsForSQLSort(const MediaType& mediaType,
     else if (sortMethod == SortByBPM)
       fields.emplace_back(FieldBPM);
   }
+  else if (mediaType == MediaTypeMovie)
+  {
+    if (sortMethod == SortByLabel || sortMethod == SortByTitle)
+      fields.emplace_back(FieldTitle);
+    else if (sortMethod == SortBySortTitle)
+      fields.emplace_back(FieldSortTitle);
+    else if (sortMethod == SortByYear)
+    {
+      fields.emplace_back(FieldYear);
+      fields.emplace_back(FieldTitle);
+    }
+    else if (sortMethod == SortByDateAdded)
+      fields.emplace_back(FieldDateAdded);
+    else if (sortMethod == SortByPlaycount)
+    {
+      fields.emplace_back(FieldPlaycount);
+      fields.emplace_back(FieldTitle);
+    }
+    else if (sortMethod == SortByLastPlayed)
+    {
+      fields.emplace_back(FieldLastPlayed);
+      fields.emplace_back(FieldTitle);
+    }
+    else if (sortMethod == SortByRating)
+    {
+      fields.emplace_back(FieldRating);
+      fields.emplace_back(FieldTitle);
+    }
+    else if (sortMethod == SortByUserRating)
+    {
+      fields.emplace_back(FieldUserRating);
+      fields.emplace_back(FieldTitle);
+    }
+    else if (sortMethod == SortByVotes)
+    {
+      fields.emplace_back(FieldVotes);
+      fields.emplace_back(FieldTitle);
+    }
+  }
   else if (mediaType == MediaTypeArtist)
   {
     if (sortMethod == SortByLabel || sortMethod == SortByTitle || sortMethod == SortByArtist)
@@ -991,27 +1076,7 @@ void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attribute
     // get the matching SortPreparator
     SortPreparator preparator = getPreparator(sortBy);
     if (preparator != NULL)
-    {
-      Fields sortingFields = GetFieldsForSorting(sortBy);
-
-      // Prepare the string used for sorting and store it under FieldSort
-      for (DatabaseResults::iterator item = items.begin(); item != items.end(); ++item)
-      {
-        // add all fields to the item that are required for sorting if they are currently missing
-        for (Fields::const_iterator field = sortingFields.begin(); field != sortingFields.end(); ++field)
-        {
-          if (item->find(*field) == item->end())
-            item->insert(std::pair<Field, CVariant>(*field, CVariant::ConstNullVariant));
-        }
-
-        std::wstring sortLabel;
-        g_charsetConverter.utf8ToW(preparator(attributes, *item), sortLabel, false);
-        item->insert(std::pair<Field, CVariant>(FieldSort, CVariant(sortLabel)));
-      }
-
-      // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorter(sortOrder, attributes));
-    }
+      SortByColumns(preparator, GetFieldsForSorting(sortBy), sortOrder, attributes, items);
   }
 
   if (limitStart > 0 && (size_t)limitStart < items.size())
@@ -1030,27 +1095,7 @@ void SortUtils::Sort(SortBy sortBy, SortOrder sortOrder, SortAttribute attribute
     // get the matching SortPreparator
     SortPreparator preparator = getPreparator(sortBy);
     if (preparator != NULL)
-    {
-      Fields sortingFields = GetFieldsForSorting(sortBy);
-
-      // Prepare the string used for sorting and store it under FieldSort
-      for (SortItems::iterator item = items.begin(); item != items.end(); ++item)
-      {
-        // add all fields to the item that are required for sorting if they are currently missing
-        for (Fields::const_iterator field = sortingFields.begin(); field != sortingFields.end(); ++field)
-        {
-          if ((*item)->find(*field) == (*item)->end())
-            (*item)->insert(std::pair<Field, CVariant>(*field, CVariant::ConstNullVariant));
-        }
-
-        std::wstring sortLabel;
-        g_charsetConverter.utf8ToW(preparator(attributes, **item), sortLabel, false);
-        (*item)->insert(std::pair<Field, CVariant>(FieldSort, CVariant(sortLabel)));
-      }
-
-      // Do the sorting
-      std::stable_sort(items.begin(), items.end(), getSorterIndirect(sortOrder, attributes));
-    }
+      SortByColumns(preparator, GetFieldsForSorting(sortBy), sortOrder, attributes, items);
   }
 
   if (limitStart > 0 && (size_t)limitStart < items.size())
@@ -1102,22 +1147,6 @@ const SortUtils::SortPreparator& SortUtils::getPreparator(SortBy sortBy)
   return m_preparators[SortByNone];
 }
 
-SortUtils::Sorter SortUtils::getSorter(SortOrder sortOrder, SortAttribute attributes)
-{
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrderDescending ? SorterIgnoreFoldersDescending : SorterIgnoreFoldersAscending;
-
-  return sortOrder == SortOrderDescending ? SorterDescending : SorterAscending;
-}
-
-SortUtils::SorterIndirect SortUtils::getSorterIndirect(SortOrder sortOrder, SortAttribute attributes)
-{
-  if (attributes & SortAttributeIgnoreFolders)
-    return sortOrder == SortOrderDescending ? SorterIndirectIgnoreFoldersDescending : SorterIndirectIgnoreFoldersAscending;
-
-  return sortOrder == SortOrderDescending ? SorterIndirectDescending : SorterIndirectAscending;
-}
-
 const Fields& SortUtils::GetFieldsForSorting(SortBy sortBy)
 {
   std::map<SortBy, Fields>::const_iterator it = m_sortingFields.find(sortBy);
@@ -1223,6 +1223,92 @@ int64_t StringUtils::AlphaNumericCompare(const wchar_t* left, const wchar_t* rig
   return 0; // files are the same
 }
 
+namespace
+{
+// Layout of the sort keys: ascii symbols keep their value, all other characters are stored with
+// an offset so that they sort after the symbols. Digits are flagged to find numbers again.
+constexpr char32_t SORTKEY_OFFSET = 0x100;
+constexpr char32_t SORTKEY_DIGIT = 0x80000000;
+
+int64_t SortKeyDigit(char32_t c)
+{
+  return static_cast<int64_t>((c & ~SORTKEY_DIGIT) - SORTKEY_OFFSET - U'0');
+}
+} // namespace
+
+void StringUtils::AppendAlphaNumericSortKey(const wchar_t* str, std::u32string& keys)
+{
+  const bool useLocaleCollation = g_langInfo.UseLocaleCollation();
+  for (const wchar_t* s = str; *s != 0; s++)
+  {
+    wchar_t c = *s;
+    if ((c >= 32 && c < L'0') || (c > L'9' && c < L'A') || (c > L'Z' && c < L'a') ||
+        (c > L'z' && c < 128))
+    {
+      keys.push_back(static_cast<char32_t>(c));
+      continue;
+    }
+    const bool digit = c >= L'0' && c <= L'9';
+    // same folding as AlphaNumericCompare()
+    if (!useLocaleCollation && c > 128)
+      c = GetCollationWeight(c);
+    if (c >= L'A' && c <= L'Z')
+      c += L'a' - L'A';
+    keys.push_back((static_cast<char32_t>(c) + SORTKEY_OFFSET) | (digit ? SORTKEY_DIGIT : 0));
+  }
+}
+
+// Equivalent of AlphaNumericCompare() for keys built by AppendAlphaNumericSortKey()
+int64_t StringUtils::AlphaNumericCompareKeys(std::u32string_view left, std::u32string_view right)
+{
+  size_t l = 0;
+  size_t r = 0;
+  while (l < left.size() && r < right.size())
+  {
+    if ((left[l] & SORTKEY_DIGIT) && (right[r] & SORTKEY_DIGIT))
+    {
+      // compare only up to 15 digits
+      size_t ld = l;
+      int64_t lnum = SortKeyDigit(left[ld++]);
+      while (ld < left.size() && (left[ld] & SORTKEY_DIGIT) && ld < l + 15)
+        lnum = lnum * 10 + SortKeyDigit(left[ld++]);
+      size_t rd = r;
+      int64_t rnum = SortKeyDigit(right[rd++]);
+      while (rd < right.size() && (right[rd] & SORTKEY_DIGIT) && rd < r + 15)
+        rnum = rnum * 10 + SortKeyDigit(right[rd++]);
+      if (lnum != rnum)
+        return lnum - rnum;
+      l = ld;
+      r = rd;
+      continue;
+    }
+
+    const char32_t lc = left[l] & ~SORTKEY_DIGIT;
+    const char32_t rc = right[r] & ~SORTKEY_DIGIT;
+    if (lc != rc)
+    {
+      // symbols are compared by value and sort above everything else
+      if (lc < SORTKEY_OFFSET || rc < SORTKEY_OFFSET || !g_langInfo.UseLocaleCollation())
+        return static_cast<int64_t>(lc) - static_cast<int64_t>(rc);
+
+      const wchar_t lw = static_cast<wchar_t>(lc - SORTKEY_OFFSET);
+      const wchar_t rw = static_cast<wchar_t>(rc - SORTKEY_OFFSET);
+      const std::collate<wchar_t>& coll =
+          std::use_facet<std::collate<wchar_t>>(g_langInfo.GetSystemLocale());
+      const int cmp_res = coll.compare(&lw, &lw + 1, &rw, &rw + 1);
+      if (cmp_res != 0)
+        return cmp_res;
+    }
+    l++;
+    r++;
+  }
+  if (r < right.size())
+    return -1;
+  if (l < left.size())
+    return 1;
+  return 0;
+}
+
 /*
   Convert the UTF8 character to which z points into a 31-bit Unicode point.
   Return how many bytes (0 to 3) of UTF8 data encode the character.
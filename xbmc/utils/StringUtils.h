@@ -25,6 +25,7 @@
 #include <stdarg.h>
 #include <stdint.h>
 #include <string>
+#include <string_view>
 #include <vector>
 
 // workaround for broken [[deprecated]] in coverity
@@ -251,6 +252,15 @@ public:
                                              size_t iMaxStrings = 0);
   static int FindNumber(const std::string& strInput, const std::string &strFind);
   static int64_t AlphaNumericCompare(const wchar_t *left, const wchar_t *right);
+  /*! \brief Append the sort key of a string to a buffer of keys
+   The characters are folded once, so that comparing the keys with AlphaNumericCompareKeys() gives
+   the same order as AlphaNumericCompare() on the strings, but is cheaper when the same strings are
+   compared many times, e.g. while sorting.
+   \param str the string to build the key for
+   \param keys buffer the key is appended to
+   */
+  static void AppendAlphaNumericSortKey(const wchar_t* str, std::u32string& keys);
+  static int64_t AlphaNumericCompareKeys(std::u32string_view left, std::u32string_view right);
   static int AlphaNumericCollation(int nKey1, const void* pKey1, int nKey2, const void* pKey2);
   static long TimeStringToSeconds(const std::string &timeString);
   static void RemoveCRLF(std::string& strLine);
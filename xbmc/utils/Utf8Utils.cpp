@@ -8,6 +8,233 @@
 
 #include "Utf8Utils.h"
 
+#include <cstring>
+#include <stdint.h>
+
+namespace
+{
+constexpr size_t ASCII_BLOCK_SIZE = sizeof(uint64_t);
+
+// checks eight bytes at once for characters beyond US-ASCII
+inline bool IsAsciiBlock(const unsigned char* str)
+{
+  uint64_t block;
+  std::memcpy(&block, str, sizeof(block));
+  return (block & 0x8080808080808080ULL) == 0;
+}
+
+inline bool IsValidCodePoint(char32_t chr)
+{
+  return chr <= 0x10FFFF && (chr < 0xD800 || chr > 0xDFFF);
+}
+
+// returns the length of the UTF-8 sequence at str or 0 for overlong forms, surrogates, values
+// beyond U+10FFFF and incomplete sequences
+size_t DecodeUtf8(const unsigned char* str, const unsigned char* end, char32_t& chr)
+{
+  const unsigned char lead = str[0];
+  size_t len;
+  char32_t min;
+  if (lead < 0x80)
+  {
+    chr = lead;
+    return 1;
+  }
+  else if (lead >= 0xC2 && lead <= 0xDF)
+  {
+    len = 2;
+    min = 0x80;
+    chr = lead & 0x1F;
+  }
+  else if (lead >= 0xE0 && lead <= 0xEF)
+  {
+    len = 3;
+    min = 0x800;
+    chr = lead & 0x0F;
+  }
+  else if (lead >= 0xF0 && lead <= 0xF4)
+  {
+    len = 4;
+    min = 0x10000;
+    chr = lead & 0x07;
+  }
+  else
+    return 0;
+
+  if (static_cast<size_t>(end - str) < len)
+    return 0;
+
+  for (size_t i = 1; i < len; ++i)
+  {
+    if ((str[i] & 0xC0) != 0x80)
+      return 0;
+    chr = (chr << 6) | (str[i] & 0x3F);
+  }
+
+  if (chr < min || !IsValidCodePoint(chr))
+    return 0;
+
+  return len;
+}
+
+// returns the number of code units of the character at str or 0 if it's invalid
+template<class CHAR>
+size_t DecodeChar(const CHAR* str, const CHAR* end, char32_t& chr)
+{
+  chr = static_cast<char32_t>(str[0]);
+  if constexpr (sizeof(CHAR) == 2)
+  {
+    if (chr >= 0xD800 && chr <= 0xDBFF && end - str > 1)
+    {
+      const char32_t low = static_cast<char32_t>(str[1]);
+      if (low >= 0xDC00 && low <= 0xDFFF)
+      {
+        chr = 0x10000 + ((chr - 0xD800) << 10) + (low - 0xDC00);
+        return 2;
+      }
+    }
+  }
+  return IsValidCodePoint(chr) ? 1 : 0;
+}
+
+template<class CHAR>
+void AppendChar(std::basic_string<CHAR>& str, char32_t chr)
+{
+  if constexpr (sizeof(CHAR) == 2)
+  {
+    if (chr >= 0x10000)
+    {
+      chr -= 0x10000;
+      str.push_back(static_cast<CHAR>(0xD800 + (chr >> 10)));
+      str.push_back(static_cast<CHAR>(0xDC00 + (chr & 0x3FF)));
+      return;
+    }
+  }
+  str.push_back(static_cast<CHAR>(chr));
+}
+
+void AppendUtf8(std::string& str, char32_t chr)
+{
+  if (chr < 0x80)
+    str.push_back(static_cast<char>(chr));
+  else if (chr < 0x800)
+  {
+    str.push_back(static_cast<char>(0xC0 | (chr >> 6)));
+    str.push_back(static_cast<char>(0x80 | (chr & 0x3F)));
+  }
+  else if (chr < 0x10000)
+  {
+    str.push_back(static_cast<char>(0xE0 | (chr >> 12)));
+    str.push_back(static_cast<char>(0x80 | ((chr >> 6) & 0x3F)));
+    str.push_back(static_cast<char>(0x80 | (chr & 0x3F)));
+  }
+  else
+  {
+    str.push_back(static_cast<char>(0xF0 | (chr >> 18)));
+    str.push_back(static_cast<char>(0x80 | ((chr >> 12) & 0x3F)));
+    str.push_back(static_cast<char>(0x80 | ((chr >> 6) & 0x3F)));
+    str.push_back(static_cast<char>(0x80 | (chr & 0x3F)));
+  }
+}
+
+template<class CHAR>
+bool FromUtf8(const std::string& str, std::basic_string<CHAR>& dst, bool failOnInvalidChar)
+{
+  dst.clear();
+  dst.reserve(str.length());
+
+  const unsigned char* pos = reinterpret_cast<const unsigned char*>(str.data());
+  const unsigned char* const end = pos + str.length();
+  while (pos < end)
+  {
+    if (static_cast<size_t>(end - pos) >= ASCII_BLOCK_SIZE && IsAsciiBlock(pos))
+    {
+      dst.append(pos, pos + ASCII_BLOCK_SIZE);
+      pos += ASCII_BLOCK_SIZE;
+      continue;
+    }
+
+    char32_t chr;
+    const size_t len = DecodeUtf8(pos, end, chr);
+    if (len == 0)
+    {
+      if (failOnInvalidChar)
+      {
+        dst.clear();
+        return false;
+      }
+      pos++; // skip invalid byte
+      continue;
+    }
+
+    AppendChar(dst, chr);
+    pos += len;
+  }
+
+  return true;
+}
+
+template<class CHAR>
+bool ToUtf8(const std::basic_string<CHAR>& str, std::string& dst, bool failOnInvalidChar)
+{
+  dst.clear();
+  dst.reserve(str.length());
+
+  const CHAR* pos = str.data();
+  const CHAR* const end = pos + str.length();
+  while (pos < end)
+  {
+    char32_t chr;
+    const size_t len = DecodeChar(pos, end, chr);
+    if (len == 0)
+    {
+      if (failOnInvalidChar)
+      {
+        dst.clear();
+        return false;
+      }
+      pos++; // skip invalid character
+      continue;
+    }
+
+    AppendUtf8(dst, chr);
+    pos += len;
+  }
+
+  return true;
+}
+
+template<class FROM, class TO>
+bool Recode(const std::basic_string<FROM>& str, std::basic_string<TO>& dst, bool failOnInvalidChar)
+{
+  dst.clear();
+  dst.reserve(str.length());
+
+  const FROM* pos = str.data();
+  const FROM* const end = pos + str.length();
+  while (pos < end)
+  {
+    char32_t chr;
+    const size_t len = DecodeChar(pos, end, chr);
+    if (len == 0)
+    {
+      if (failOnInvalidChar)
+      {
+        dst.clear();
+        return false;
+      }
+      pos++; // skip invalid character
+      continue;
+    }
+
+    AppendChar(dst, chr);
+    pos += len;
+  }
+
+  return true;
+}
+} // namespace
+
 
 CUtf8Utils::utf8CheckResult CUtf8Utils::checkStrForUtf8(const std::string& str)
 {
@@ -18,6 +245,13 @@ CUtf8Utils::utf8CheckResult CUtf8Utils::checkStrForUtf8(const std::string& str)
 
   while (pos < len)
   {
+    if (len - pos >= ASCII_BLOCK_SIZE &&
+        IsAsciiBlock(reinterpret_cast<const unsigned char*>(strC + pos)))
+    {
+      pos += ASCII_BLOCK_SIZE;
+      continue;
+    }
+
     const size_t chrLen = SizeOfUtf8Char(strC + pos);
     if (chrLen == 0)
       return hiAscii; // non valid UTF-8 sequence
@@ -33,6 +267,38 @@ CUtf8Utils::utf8CheckResult CUtf8Utils::checkStrForUtf8(const std::string& str)
   return utf8string;   // valid UTF-8 with at least one valid UTF-8 multi-byte sequence
 }
 
+bool CUtf8Utils::Utf8ToUtf32(const std::string& str,
+                             std::u32string& utf32,
+                             bool failOnInvalidChar)
+{
+  return FromUtf8(str, utf32, failOnInvalidChar);
+}
+
+bool CUtf8Utils::Utf8ToW(const std::string& str, std::wstring& wstr, bool failOnInvalidChar)
+{
+  return FromUtf8(str, wstr, failOnInvalidChar);
+}
+
+bool CUtf8Utils::Utf32ToUtf8(const std::u32string& str, std::string& utf8, bool failOnInvalidChar)
+{
+  return ToUtf8(str, utf8, failOnInvalidChar);
+}
+
+bool CUtf8Utils::WToUtf8(const std::wstring& str, std::string& utf8, bool failOnInvalidChar)
+{
+  return ToUtf8(str, utf8, failOnInvalidChar);
+}
+
+bool CUtf8Utils::Utf32ToW(const std::u32string& str, std::wstring& wstr, bool failOnInvalidChar)
+{
+  return Recode(str, wstr, failOnInvalidChar);
+}
+
+bool CUtf8Utils::WToUtf32(const std::wstring& str, std::u32string& utf32, bool failOnInvalidChar)
+{
+  return Recode(str, utf32, failOnInvalidChar);
+}
+
 
 
 size_t CUtf8Utils::FindValidUtf8Char(const std::string& str, const size_t startPos /*= 0*/)
@@ -125,8 +391,8 @@ inline size_t CUtf8Utils::SizeOfUtf8Char(const char* const str)
 
   /* U+10000 - U+3FFFF in UTF-8 */
   if (chr == 0xF0                                   /* F0=1111 0000 */
-      && (strU[1] & 0xE0) == 0x80     /* E0=1110 0000, 80=1000 0000 - 9F=1001 1111 */
-      && strU[2] >= 0x90 && strU[2] <= 0xBF         /* 90=1001 0000 - BF=1011 1111 */
+      && strU[1] >= 0x90 && strU[1] <= 0xBF         /* 90=1001 0000 - BF=1011 1111 */
+      && (strU[2] & 0xC0) == 0x80     /* C0=1100 0000, 80=1000 0000 - BF=1011 1111 */
       && (strU[3] & 0xC0) == 0x80)    /* C0=1100 0000, 80=1000 0000 - BF=1011 1111 */
     return 4; // valid UTF-8 4 bytes sequence
 
@@ -37,6 +37,50 @@ public:
   static size_t RFindValidUtf8Char(const std::string& str, const size_t startPos);
 
   static size_t SizeOfUtf8Char(const std::string& str, const size_t charStart = 0);
+
+  /**
+   * Convert UTF-8 to UTF-32 without iconv, runs of US-ASCII characters are copied eight at once
+   * @param str string to convert
+   * @param utf32 converted string
+   * @param failOnInvalidChar fail on invalid sequences, otherwise invalid bytes are skipped
+   * @return false if an invalid sequence was found and failOnInvalidChar is set
+   */
+  static bool Utf8ToUtf32(const std::string& str, std::u32string& utf32, bool failOnInvalidChar);
+
+  /**
+   * Convert UTF-8 to a wide string, UTF-16 or UTF-32 depending on the size of wchar_t
+   * @see Utf8ToUtf32
+   */
+  static bool Utf8ToW(const std::string& str, std::wstring& wstr, bool failOnInvalidChar);
+
+  /**
+   * Convert UTF-32 to UTF-8 without iconv
+   * @param str string to convert
+   * @param utf8 converted string
+   * @param failOnInvalidChar fail on surrogates and values beyond U+10FFFF, otherwise they are
+   *                          skipped
+   * @return false if an invalid character was found and failOnInvalidChar is set
+   */
+  static bool Utf32ToUtf8(const std::u32string& str, std::string& utf8, bool failOnInvalidChar);
+
+  /**
+   * Convert a wide string, UTF-16 or UTF-32 depending on the size of wchar_t, to UTF-8
+   * @see Utf32ToUtf8
+   */
+  static bool WToUtf8(const std::wstring& str, std::string& utf8, bool failOnInvalidChar);
+
+  /**
+   * Convert UTF-32 to a wide string without iconv
+   * @see Utf32ToUtf8
+   */
+  static bool Utf32ToW(const std::u32string& str, std::wstring& wstr, bool failOnInvalidChar);
+
+  /**
+   * Convert a wide string to UTF-32 without iconv
+   * @see WToUtf8
+   */
+  static bool WToUtf32(const std::wstring& str, std::u32string& utf32, bool failOnInvalidChar);
+
 private:
   static size_t SizeOfUtf8Char(const char* const str);
 };
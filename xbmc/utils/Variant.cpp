@@ -10,10 +10,14 @@
 
 #include "Variant.h"
 
+#include <algorithm>
 #include <charconv>
 #include <cstdlib>
 #include <cstring>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <unordered_set>
 #include <utility>
 #include <variant>
 
@@ -138,6 +142,202 @@ double str2double(std::wstring_view str, double fallback /* = 0.0 */)
   return fallback;
 }
 
+namespace
+{
+/*!
+ \brief Shared copies of the keys of object members
+
+ Only short keys are interned and the number of them is limited, so that objects built from
+ arbitrary input can't grow the pool forever. Keys that don't make it into the pool are copied.
+ */
+class CKeyPool
+{
+public:
+  static CKeyPool& Get()
+  {
+    // never destroyed, static variants may still refer to it
+    static CKeyPool* pool = new CKeyPool;
+    return *pool;
+  }
+
+  const std::string* Intern(std::string_view key)
+  {
+    if (key.size() > MAX_KEY_LENGTH)
+      return nullptr;
+
+    {
+      std::shared_lock<std::shared_mutex> lock(m_mutex);
+      const auto it = m_keys.find(key);
+      if (it != m_keys.end())
+        return &*it;
+      if (m_keys.size() >= MAX_KEYS)
+        return nullptr;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    if (m_keys.size() >= MAX_KEYS)
+    {
+      const auto it = m_keys.find(key);
+      return it != m_keys.end() ? &*it : nullptr;
+    }
+    return &*m_keys.emplace(key).first;
+  }
+
+private:
+  static constexpr size_t MAX_KEY_LENGTH = 32;
+  static constexpr size_t MAX_KEYS = 4096;
+
+  struct Hash
+  {
+    using is_transparent = void;
+    size_t operator()(std::string_view key) const { return std::hash<std::string_view>{}(key); }
+  };
+
+  std::shared_mutex m_mutex;
+  std::unordered_set<std::string, Hash, std::equal_to<>> m_keys;
+};
+} // namespace
+
+CVariant::VariantMap::Key::Key(std::string_view key)
+{
+  const std::string* interned = CKeyPool::Get().Intern(key);
+  if (interned)
+    m_key = reinterpret_cast<uintptr_t>(interned);
+  else
+    m_key = reinterpret_cast<uintptr_t>(new std::string(key)) | OWNED;
+}
+
+CVariant::VariantMap::Key::Key(const Key& other) : m_key(other.m_key)
+{
+  if (m_key & OWNED)
+    m_key = reinterpret_cast<uintptr_t>(new std::string(other.str())) | OWNED;
+}
+
+CVariant::VariantMap::Key& CVariant::VariantMap::Key::operator=(const Key& other)
+{
+  if (this != &other)
+  {
+    Key copy(other);
+    std::swap(m_key, copy.m_key);
+  }
+  return *this;
+}
+
+CVariant::VariantMap::Key& CVariant::VariantMap::Key::operator=(Key&& other) noexcept
+{
+  std::swap(m_key, other.m_key);
+  return *this;
+}
+
+CVariant::VariantMap::Key::~Key()
+{
+  if (m_key & OWNED)
+    delete &str();
+}
+
+CVariant::VariantMap::VariantMap() = default;
+
+CVariant::VariantMap::VariantMap(const std::map<std::string, CVariant>& variantMap)
+{
+  m_members.reserve(variantMap.size());
+  for (const auto& member : variantMap)
+    m_members.emplace_back(Key(member.first), CVariant(member.second));
+}
+
+CVariant::VariantMap::VariantMap(std::map<std::string, CVariant>&& variantMap)
+{
+  m_members.reserve(variantMap.size());
+  for (auto& member : variantMap)
+    m_members.emplace_back(Key(member.first), std::move(member.second));
+}
+
+CVariant::VariantMap::VariantMap(const VariantMap& other) = default;
+
+CVariant::VariantMap::VariantMap(VariantMap&& other) noexcept = default;
+
+CVariant::VariantMap& CVariant::VariantMap::operator=(const VariantMap& other) = default;
+
+CVariant::VariantMap& CVariant::VariantMap::operator=(VariantMap&& other) noexcept = default;
+
+CVariant::VariantMap::~VariantMap() = default;
+
+CVariant::VariantMap::iterator CVariant::VariantMap::begin()
+{
+  return iterator(m_members.data());
+}
+
+CVariant::VariantMap::const_iterator CVariant::VariantMap::begin() const
+{
+  return const_iterator(m_members.data());
+}
+
+CVariant::VariantMap::iterator CVariant::VariantMap::end()
+{
+  return iterator(m_members.data() + m_members.size());
+}
+
+CVariant::VariantMap::const_iterator CVariant::VariantMap::end() const
+{
+  return const_iterator(m_members.data() + m_members.size());
+}
+
+void CVariant::VariantMap::clear()
+{
+  m_members.clear();
+}
+
+size_t CVariant::VariantMap::lower_bound(std::string_view key) const
+{
+  // members are mostly added in order, e.g. when copying or parsing sorted output
+  if (m_members.empty() || std::string_view(m_members.back().key.str()) < key)
+    return m_members.size();
+
+  const auto it = std::lower_bound(
+      m_members.begin(), m_members.end(), key,
+      [](const Member& member, std::string_view value) { return member.key.str() < value; });
+  return it - m_members.begin();
+}
+
+CVariant* CVariant::VariantMap::find(std::string_view key)
+{
+  const size_t index = lower_bound(key);
+  if (index < m_members.size() && m_members[index].key.str() == key)
+    return &m_members[index].value;
+  return nullptr;
+}
+
+const CVariant* CVariant::VariantMap::find(std::string_view key) const
+{
+  const size_t index = lower_bound(key);
+  if (index < m_members.size() && m_members[index].key.str() == key)
+    return &m_members[index].value;
+  return nullptr;
+}
+
+CVariant& CVariant::VariantMap::operator[](std::string_view key)
+{
+  const size_t index = lower_bound(key);
+  if (index < m_members.size() && m_members[index].key.str() == key)
+    return m_members[index].value;
+
+  return m_members.emplace(m_members.begin() + index, Key(key), CVariant())->value;
+}
+
+void CVariant::VariantMap::erase(std::string_view key)
+{
+  const size_t index = lower_bound(key);
+  if (index < m_members.size() && m_members[index].key.str() == key)
+    m_members.erase(m_members.begin() + index);
+}
+
+bool CVariant::VariantMap::operator==(const VariantMap& rhs) const
+{
+  return std::equal(m_members.begin(), m_members.end(), rhs.m_members.begin(),
+                    rhs.m_members.end(), [](const Member& left, const Member& right) {
+                      return left.key.str() == right.key.str() && left.value == right.value;
+                    });
+}
+
 CVariant::CVariant()
   : CVariant(VariantTypeNull)
 {
@@ -270,7 +470,7 @@ CVariant::CVariant(const std::map<std::string, std::string> &strMap)
 {
   VariantMap tmpMap;
   for (const auto& elem : strMap)
-    tmpMap.emplace(elem.first, CVariant(elem.second));
+    tmpMap[elem.first] = CVariant(elem.second);
 
   m_data = std::move(tmpMap);
 }
@@ -279,7 +479,7 @@ CVariant::CVariant(std::map<std::string, std::string>&& strMap)
 {
   VariantMap tmpMap;
   for (auto& elem : strMap)
-    tmpMap.emplace(elem.first, CVariant(std::move(elem.second)));
+    tmpMap[elem.first] = CVariant(std::move(elem.second));
 
   m_data = std::move(tmpMap);
 }
@@ -479,8 +679,8 @@ CVariant& CVariant::operator[](const std::string& key) &
 const CVariant& CVariant::operator[](const std::string& key) const&
 {
   return std::visit(overloaded{[&](const VariantMap& m) -> const CVariant& {
-                                 auto it = m.find(key);
-                                 return it != m.cend() ? it->second : ConstNullVariant;
+                                 const CVariant* value = m.find(key);
+                                 return value ? *value : ConstNullVariant;
                                },
                                [](const auto&) -> const CVariant& { return ConstNullVariant; }},
                     m_data);
@@ -489,8 +689,8 @@ const CVariant& CVariant::operator[](const std::string& key) const&
 CVariant CVariant::operator[](const std::string& key) &&
 {
   return std::visit(overloaded{[&](VariantMap& m) -> CVariant {
-                                 auto it = m.find(key);
-                                 return it != m.cend() ? std::move(it->second) : ConstNullVariant;
+                                 CVariant* value = m.find(key);
+                                 return value ? std::move(*value) : ConstNullVariant;
                                },
                                [](auto&) -> CVariant { return ConstNullVariant; }},
                     m_data);
@@ -639,8 +839,8 @@ CVariant::iterator_map CVariant::begin_map()
 
 CVariant::const_iterator_map CVariant::begin_map() const
 {
-  return std::visit(overloaded{[](const VariantMap& a) { return a.cbegin(); },
-                               [](const auto&) { return EMPTY_MAP.cbegin(); }},
+  return std::visit(overloaded{[](const VariantMap& a) { return a.begin(); },
+                               [](const auto&) { return std::as_const(EMPTY_MAP).begin(); }},
                     m_data);
 }
 
@@ -653,8 +853,8 @@ CVariant::iterator_map CVariant::end_map()
 
 CVariant::const_iterator_map CVariant::end_map() const
 {
-  return std::visit(overloaded{[](const VariantMap& m) { return m.cend(); },
-                               [](const auto&) { return EMPTY_MAP.cend(); }},
+  return std::visit(overloaded{[](const VariantMap& m) { return m.end(); },
+                               [](const auto&) { return std::as_const(EMPTY_MAP).end(); }},
                     m_data);
 }
 
@@ -703,7 +903,7 @@ void CVariant::erase(unsigned int position)
 
 bool CVariant::isMember(const std::string &key) const
 {
-  return std::visit(overloaded{[&](const VariantMap& m) { return m.find(key) != m.end(); },
+  return std::visit(overloaded{[&](const VariantMap& m) { return m.find(key) != nullptr; },
                                [](const auto&) { return false; }},
                     m_data);
 }
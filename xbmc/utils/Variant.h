@@ -8,10 +8,13 @@
 
 #pragma once
 
+#include <cstddef>
+#include <iterator>
 #include <map>
 #include <stdint.h>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <variant>
 #include <vector>
 #include <wchar.h>
@@ -124,7 +127,121 @@ public:
 
 private:
   typedef std::vector<CVariant> VariantArray;
-  typedef std::map<std::string, CVariant> VariantMap;
+
+  /*!
+   \brief Members of an object, stored in a vector sorted by key
+
+   Objects mostly have a handful of members, which a flat vector holds in a fraction of the
+   memory of a tree and walks faster. Short keys like "label" or "file" are interned, so every
+   object only stores a pointer to a shared copy of them. As with a vector, references to members
+   are invalidated by adding members to or removing them from the same object.
+   */
+  class VariantMap
+  {
+  public:
+    class Key
+    {
+    public:
+      explicit Key(std::string_view key);
+      Key(const Key& other);
+      Key(Key&& other) noexcept : m_key(other.m_key) { other.m_key = 0; }
+      Key& operator=(const Key& other);
+      Key& operator=(Key&& other) noexcept;
+      ~Key();
+
+      const std::string& str() const
+      {
+        return *reinterpret_cast<const std::string*>(m_key & ~OWNED);
+      }
+
+    private:
+      static constexpr uintptr_t OWNED = 1;
+
+      uintptr_t m_key; //!< pointer to the interned or an owned string, tagged with OWNED
+    };
+
+    struct Member;
+
+    template<bool Const>
+    class Iterator
+    {
+      using MemberPtr = std::conditional_t<Const, const Member*, Member*>;
+
+    public:
+      using iterator_category = std::bidirectional_iterator_tag;
+      using difference_type = std::ptrdiff_t;
+      using value_type = std::pair<const std::string, CVariant>;
+      using reference =
+          std::pair<const std::string&, std::conditional_t<Const, const CVariant&, CVariant&>>;
+
+      struct pointer
+      {
+        reference ref;
+        const reference* operator->() const { return &ref; }
+      };
+
+      Iterator() = default;
+      explicit Iterator(MemberPtr member) : m_member(member) {}
+      template<bool C = Const, typename = std::enable_if_t<C>>
+      Iterator(const Iterator<false>& other) : m_member(other.m_member)
+      {
+      }
+
+      reference operator*() const;
+      pointer operator->() const { return pointer{**this}; }
+      Iterator& operator++()
+      {
+        ++m_member;
+        return *this;
+      }
+      Iterator operator++(int) { return Iterator(m_member++); }
+      Iterator& operator--()
+      {
+        --m_member;
+        return *this;
+      }
+      Iterator operator--(int) { return Iterator(m_member--); }
+      bool operator==(const Iterator& rhs) const { return m_member == rhs.m_member; }
+      bool operator!=(const Iterator& rhs) const { return m_member != rhs.m_member; }
+
+    private:
+      friend class Iterator<true>;
+      MemberPtr m_member = nullptr;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    VariantMap();
+    explicit VariantMap(const std::map<std::string, CVariant>& variantMap);
+    explicit VariantMap(std::map<std::string, CVariant>&& variantMap);
+    VariantMap(const VariantMap& other);
+    VariantMap(VariantMap&& other) noexcept;
+    VariantMap& operator=(const VariantMap& other);
+    VariantMap& operator=(VariantMap&& other) noexcept;
+    ~VariantMap();
+
+    iterator begin();
+    const_iterator begin() const;
+    iterator end();
+    const_iterator end() const;
+
+    size_t size() const { return m_members.size(); }
+    bool empty() const { return m_members.empty(); }
+    void clear();
+
+    CVariant* find(std::string_view key);
+    const CVariant* find(std::string_view key) const;
+    CVariant& operator[](std::string_view key);
+    void erase(std::string_view key);
+
+    bool operator==(const VariantMap& rhs) const;
+
+  private:
+    size_t lower_bound(std::string_view key) const;
+
+    std::vector<Member> m_members;
+  };
 
 public:
   typedef VariantArray::iterator        iterator_array;
@@ -182,6 +299,39 @@ private:
   static VariantMap EMPTY_MAP;
 };
 
+struct CVariant::VariantMap::Member
+{
+  Member(Key&& memberKey, CVariant&& memberValue)
+    : key(std::move(memberKey)), value(std::move(memberValue))
+  {
+  }
+  Member(const Member& other) = default;
+  Member(Member&& other) noexcept = default;
+  // assign the data directly, CVariant's assignment operators ignore the const null variant
+  Member& operator=(const Member& other)
+  {
+    key = other.key;
+    value.m_data = other.value.m_data;
+    return *this;
+  }
+  Member& operator=(Member&& other) noexcept
+  {
+    key = std::move(other.key);
+    value.swap(other.value);
+    return *this;
+  }
+
+  Key key;
+  CVariant value;
+};
+
+template<bool Const>
+inline typename CVariant::VariantMap::Iterator<Const>::reference CVariant::VariantMap::Iterator<
+    Const>::operator*() const
+{
+  return reference(m_member->key.str(), m_member->value);
+}
+
 #ifdef TARGET_WINDOWS_STORE
 #pragma pack(pop)
 #endif
@@ -241,6 +241,69 @@ TEST_F(TestCharsetConverter, isValidUtf8_4)
   EXPECT_FALSE(CUtf8Utils::isValidUtf8(refutf16LE3));
 }
 
+TEST_F(TestCharsetConverter, isValidUtf8_5)
+{
+  EXPECT_TRUE(CUtf8Utils::isValidUtf8("plain ascii text, \xF0\x90\x80\x80 and more plain text"));
+  EXPECT_FALSE(CUtf8Utils::isValidUtf8("plain ascii text, \xF0\x80\x90\x80 and more plain text"));
+}
+
+TEST_F(TestCharsetConverter, utf8ToUtf32)
+{
+  const std::string utf8 = "plain ascii \xC3\xA4\xE2\x82\xAC\xF0\x9F\x98\x80 text";
+  const std::u32string utf32 = U"plain ascii \u00E4\u20AC\U0001F600 text";
+  std::u32string varstr32;
+  EXPECT_TRUE(g_charsetConverter.utf8ToUtf32(utf8, varstr32));
+  EXPECT_EQ(utf32, varstr32);
+
+  std::string varstr8;
+  EXPECT_TRUE(g_charsetConverter.utf32ToUtf8(varstr32, varstr8));
+  EXPECT_EQ(utf8, varstr8);
+}
+
+TEST_F(TestCharsetConverter, utf8ToUtf32_invalid)
+{
+  // overlong form, surrogate and truncated sequence
+  const std::string utf8 = "a\xC0\xAF" "b\xED\xA0\x80" "c\xE2\x82";
+  std::u32string varstr32;
+  EXPECT_FALSE(g_charsetConverter.utf8ToUtf32(utf8, varstr32, true));
+  EXPECT_TRUE(varstr32.empty());
+  EXPECT_TRUE(g_charsetConverter.utf8ToUtf32(utf8, varstr32, false));
+  EXPECT_EQ(U"abc", varstr32);
+
+  std::string varstr8;
+  EXPECT_FALSE(g_charsetConverter.utf32ToUtf8(std::u32string(1, 0xD800), varstr8, true));
+  EXPECT_TRUE(g_charsetConverter.utf32ToUtf8(U"a" + std::u32string(1, 0x110000), varstr8, false));
+  EXPECT_EQ("a", varstr8);
+}
+
+TEST_F(TestCharsetConverter, utf32ToW)
+{
+  const std::u32string utf32 = U"plain ascii \u00E4\u20AC\U0001F600 text";
+  const std::wstring wstr = L"plain ascii \u00E4\u20AC\U0001F600 text";
+  std::wstring varstrw;
+  EXPECT_TRUE(g_charsetConverter.utf32ToW(utf32, varstrw));
+  EXPECT_EQ(wstr, varstrw);
+
+  std::u32string varstr32;
+  EXPECT_TRUE(g_charsetConverter.wToUtf32(varstrw, varstr32));
+  EXPECT_EQ(utf32, varstr32);
+}
+
+TEST_F(TestCharsetConverter, utf32ToW_invalid)
+{
+  std::wstring varstrw;
+  EXPECT_FALSE(g_charsetConverter.utf32ToW(U"a" + std::u32string(1, 0xD800), varstrw, true));
+  EXPECT_TRUE(varstrw.empty());
+  EXPECT_TRUE(g_charsetConverter.utf32ToW(U"a" + std::u32string(1, 0x110000), varstrw, false));
+  EXPECT_EQ(L"a", varstrw);
+
+  // unpaired surrogate
+  std::u32string varstr32;
+  EXPECT_FALSE(g_charsetConverter.wToUtf32(L"a" + std::wstring(1, 0xDC00), varstr32, true));
+  EXPECT_TRUE(g_charsetConverter.wToUtf32(L"a" + std::wstring(1, 0xDC00), varstr32, false));
+  EXPECT_EQ(U"a", varstr32);
+}
+
 //! @todo Resolve correct input/output for this function
 // TEST_F(TestCharsetConverter, ucs2CharsetToStringCharset)
 // {
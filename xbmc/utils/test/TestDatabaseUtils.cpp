@@ -9,6 +9,7 @@
 #include "dbwrappers/qry_dat.h"
 #include "music/MusicDatabase.h"
 #include "utils/DatabaseUtils.h"
+#include "utils/SortUtils.h"
 #include "utils/StringUtils.h"
 #include "utils/Variant.h"
 #include "video/VideoDatabase.h"
@@ -1368,6 +1369,61 @@ TEST(TestDatabaseUtils, BuildLimitClause)
   EXPECT_STREQ(" LIMIT 100", a.c_str());
 }
 
+TEST(TestDatabaseUtils, BuildKeysetCondition)
+{
+  CVariant values(CVariant::VariantTypeArray);
+  values.push_back("The Title");
+  values.push_back(2001);
+  values.push_back(42);
+
+  std::vector<dbiplus::field_value> params;
+  std::string condition =
+      DatabaseUtils::BuildKeysetCondition({"title", "year", "id"}, false, values, params);
+  EXPECT_EQ(condition, "(title > ? OR (title = ? AND ((year > ? OR (year = ? AND (id > ?))))))");
+  ASSERT_EQ(params.size(), 5u);
+  EXPECT_EQ(params[0].get_asString(), "The Title");
+  EXPECT_EQ(params[1].get_asString(), "The Title");
+  EXPECT_EQ(params[2].get_asInt64(), 2001);
+  EXPECT_EQ(params[3].get_asInt64(), 2001);
+  EXPECT_EQ(params[4].get_asInt64(), 42);
+
+  params.clear();
+  values = CVariant(CVariant::VariantTypeArray);
+  EXPECT_TRUE(DatabaseUtils::BuildKeysetCondition({"id"}, true, values, params).empty());
+  values.push_back(7);
+  EXPECT_EQ(DatabaseUtils::BuildKeysetCondition({"id"}, true, values, params), "id < ?");
+  EXPECT_EQ(params.size(), 1u);
+}
+
+TEST(TestDatabaseUtils, KeysetCursor)
+{
+  SortDescription sorting;
+  sorting.sortBy = SortByRating;
+  sorting.sortOrder = SortOrderDescending;
+
+  CVariant values(CVariant::VariantTypeArray);
+  values.push_back(0.1 + 0.2);
+  values.push_back("Title");
+  values.push_back(12);
+
+  sorting.limitCursor = DatabaseUtils::EncodeKeysetCursor(sorting, values);
+  ASSERT_FALSE(sorting.limitCursor.empty());
+
+  CVariant decoded;
+  ASSERT_TRUE(DatabaseUtils::DecodeKeysetCursor(sorting, decoded));
+  ASSERT_EQ(decoded.size(), 3u);
+  EXPECT_EQ(decoded[0].asDouble(), 0.1 + 0.2);
+  EXPECT_EQ(decoded[1].asString(), "Title");
+  EXPECT_EQ(decoded[2].asInteger(), 12);
+
+  // a cursor is only valid for the sorting it was created with
+  sorting.sortOrder = SortOrderAscending;
+  EXPECT_FALSE(DatabaseUtils::DecodeKeysetCursor(sorting, decoded));
+  sorting.sortOrder = SortOrderDescending;
+  sorting.limitCursor = "garbage";
+  EXPECT_FALSE(DatabaseUtils::DecodeKeysetCursor(sorting, decoded));
+}
+
 // class DatabaseUtils
 // {
 // public:
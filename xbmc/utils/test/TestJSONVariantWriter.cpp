@@ -9,6 +9,9 @@
 #include "utils/JSONVariantWriter.h"
 #include "utils/Variant.h"
 
+#include <cmath>
+#include <string>
+
 #include <gtest/gtest.h>
 
 TEST(TestJSONVariantWriter, CanWriteNull)
@@ -149,3 +152,95 @@ TEST(TestJSONVariantWriter, CanWriteArray)
   ASSERT_TRUE(CJSONVariantWriter::Write(variant, str, false));
   ASSERT_STREQ("[\n\t{\n\t\t\"foo\": \"bar\"\n\t}\n]", str.c_str());
 }
+
+namespace
+{
+CVariant GetLibrary(int songs)
+{
+  CVariant result;
+  result["jsonrpc"] = "2.0";
+  result["id"] = 1;
+  for (int i = 0; i < songs; i++)
+  {
+    CVariant song;
+    song["songid"] = i;
+    song["title"] = "Song \"" + std::to_string(i) + "\"";
+    song["artist"].push_back("Artist " + std::to_string(i % 100));
+    song["rating"] = i / 7.0;
+    song["userrating"] = CVariant::VariantTypeNull;
+    song["genre"] = CVariant::VariantTypeArray;
+    song["art"] = CVariant::VariantTypeObject;
+    result["result"]["songs"].push_back(song);
+  }
+  result["result"]["limits"]["total"] = songs;
+  return result;
+}
+
+std::string ReadStream(CJSONVariantStream& stream, size_t chunkSize)
+{
+  std::string output;
+  std::string chunk(chunkSize, '\0');
+  size_t read;
+  while ((read = stream.Read(chunk.data(), chunk.size())) > 0)
+  {
+    EXPECT_LE(read, chunkSize);
+    output.append(chunk, 0, read);
+  }
+  return output;
+}
+} // namespace
+
+TEST(TestJSONVariantWriter, StreamMatchesWrite)
+{
+  for (const CVariant& value : {CVariant(), CVariant(true), CVariant("foo"),
+                                CVariant(CVariant::VariantTypeArray),
+                                CVariant(CVariant::VariantTypeObject), GetLibrary(100)})
+  {
+    for (bool compact : {true, false})
+    {
+      std::string expected;
+      ASSERT_TRUE(CJSONVariantWriter::Write(value, expected, compact));
+
+      for (size_t chunkSize : {1, 7, 4096, 1 << 20})
+      {
+        CJSONVariantStream stream(value, compact);
+        EXPECT_EQ(ReadStream(stream, chunkSize), expected);
+        EXPECT_TRUE(stream.IsComplete());
+        EXPECT_FALSE(stream.HasFailed());
+        EXPECT_EQ(stream.Read(expected.data(), expected.size()), 0u);
+      }
+    }
+  }
+}
+
+TEST(TestJSONVariantWriter, StreamFailsOnInvalidValue)
+{
+  CVariant value;
+  value.push_back(1);
+  value.push_back(std::nan(""));
+  CJSONVariantStream stream(value, true);
+
+  char buffer[64];
+  EXPECT_EQ(stream.Read(buffer, sizeof(buffer)), 0u);
+  EXPECT_TRUE(stream.HasFailed());
+  EXPECT_FALSE(stream.IsComplete());
+}
+
+TEST(TestJSONVariantWriter, StreamKeepsOutputBeforeFailure)
+{
+  CVariant value;
+  value.push_back("abcdef");
+  value.push_back(std::nan(""));
+  CJSONVariantStream stream(value, true);
+
+  char buffer[64];
+  ASSERT_EQ(stream.Read(buffer, 4), 4u);
+  EXPECT_EQ(std::string(buffer, 4), "[\"ab");
+
+  // the rest of the string has been serialized before the failure
+  ASSERT_EQ(stream.Read(buffer, sizeof(buffer)), 5u);
+  EXPECT_EQ(std::string(buffer, 5), "cdef\"");
+  EXPECT_TRUE(stream.HasFailed());
+  EXPECT_EQ(stream.Read(buffer, sizeof(buffer)), 0u);
+  EXPECT_FALSE(stream.IsComplete());
+}
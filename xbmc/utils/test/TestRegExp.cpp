@@ -14,6 +14,7 @@
 #include "filesystem/File.h"
 #include "filesystem/SpecialProtocol.h"
 #include "utils/RegExp.h"
+#include "utils/RegExpSet.h"
 #include "utils/StringUtils.h"
 #include "utils/log.h"
 
@@ -129,6 +130,41 @@ TEST(TestRegExp, operatorEqual)
   EXPECT_EQ(0, regexcopy.RegFind("Test string."));
 }
 
+TEST(TestRegExp, IsMatch)
+{
+  CRegExp regex(true);
+
+  EXPECT_TRUE(regex.RegComp("s(\\d+)e(\\d+)", CRegExp::StudyWithJitComp));
+  EXPECT_TRUE(regex.IsMatch("Show.S01E02.mkv"));
+  EXPECT_FALSE(regex.IsMatch("Show.mkv"));
+
+  // copies share the compiled expression
+  const CRegExp regexcopy(regex);
+  EXPECT_TRUE(regexcopy.IsMatch("show.s01e02.mkv"));
+  EXPECT_FALSE(CRegExp().IsMatch("Show.S01E02.mkv"));
+}
+
+TEST(TestRegExp, RegExpSet)
+{
+  const std::vector<std::string> regexps = {"\\.sample\\.", "+", "s(\\d+)e(\\d+)",
+                                            "(\\d+)x(\\d+)"};
+  const auto set = CRegExpSet::Get(regexps);
+  EXPECT_EQ(set, CRegExpSet::Get(regexps));
+  EXPECT_FALSE(set->IsEmpty());
+
+  EXPECT_EQ(-1, set->Find("Movie.mkv"));
+  EXPECT_EQ(0, set->Find("Movie.SAMPLE.mkv"));
+
+  CRegExp match;
+  EXPECT_EQ(2, set->Find("Show.S01E02.1x03.mkv", &match));
+  EXPECT_EQ("01", match.GetMatch(1));
+  EXPECT_EQ("02", match.GetMatch(2));
+  EXPECT_EQ(3, set->Find("Show.S01E02.1x03.mkv", &match, 3));
+  EXPECT_EQ("1", match.GetMatch(1));
+  EXPECT_EQ("03", match.GetMatch(2));
+  EXPECT_EQ("(\\d+)x(\\d+)", set->GetPattern(3));
+}
+
 class TestRegExpLog : public testing::Test
 {
 protected:
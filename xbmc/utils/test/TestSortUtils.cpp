@@ -7,10 +7,93 @@
  */
 
 #include "utils/SortUtils.h"
+#include "utils/StringUtils.h"
 #include "utils/Variant.h"
 
+#include <algorithm>
+#include <random>
+#include <string>
+
 #include <gtest/gtest.h>
 
+namespace
+{
+SortItems GetSongs(size_t count)
+{
+  static const char* words[] = {"the", "Beatles", "abba", "AC/DC", "Ärzte", "zz top",
+                                "(live)", "01", "2", "10", "b-52", "été", "ÉTÉ", "#1",
+                                "alpha", "Omega"};
+  std::mt19937 random(42);
+  const auto name = [&random](size_t length) {
+    std::string name;
+    for (size_t i = 0; i < length; i++)
+    {
+      if (i > 0)
+        name += " ";
+      name += words[random() % std::size(words)];
+    }
+    return name;
+  };
+
+  SortItems items;
+  for (size_t i = 0; i < count; i++)
+  {
+    SortItemPtr item(new SortItem());
+    (*item)[FieldId] = static_cast<int64_t>(i);
+    (*item)[FieldLabel] = name(random() % 3 + 1);
+    (*item)[FieldArtist] = name(random() % 2 + 1);
+    (*item)[FieldAlbum] = name(random() % 3 + 1);
+    (*item)[FieldYear] = static_cast<int64_t>(1960 + random() % 60);
+    (*item)[FieldTrackNumber] = static_cast<int64_t>(random() % 20);
+    (*item)[FieldFolder] = random() % 4 == 0;
+    if (random() % 50 == 0)
+      (*item)[FieldSortSpecial] = static_cast<int64_t>(random() % 3);
+    items.push_back(item);
+  }
+  return items;
+}
+
+// the comparison SortUtils::Sort has to match, working on the rows directly
+bool RowLess(const SortItem& left, const SortItem& right, bool descending, bool handleFolders)
+{
+  const auto special = [](const SortItem& item) {
+    const auto it = item.find(FieldSortSpecial);
+    return it == item.end() ? SortSpecialNone : static_cast<SortSpecial>(it->second.asInteger());
+  };
+  if (special(left) != special(right))
+    return special(left) == SortSpecialOnTop || special(right) == SortSpecialOnBottom;
+  if (special(left) != SortSpecialNone)
+    return false;
+
+  if (handleFolders && left.at(FieldFolder).asBoolean() != right.at(FieldFolder).asBoolean())
+    return left.at(FieldFolder).asBoolean();
+
+  const std::wstring labelLeft = left.at(FieldSort).asWideString();
+  const std::wstring labelRight = right.at(FieldSort).asWideString();
+  const int64_t result = StringUtils::AlphaNumericCompare(labelLeft.c_str(), labelRight.c_str());
+  return descending ? result > 0 : result < 0;
+}
+
+void CheckRowOrder(SortBy sortBy, SortOrder sortOrder, SortAttribute attributes, size_t count)
+{
+  SortItems items = GetSongs(count);
+  SortItems expected = items;
+
+  SortUtils::Sort(sortBy, sortOrder, attributes, items);
+
+  // FieldSort has been filled in by now
+  std::stable_sort(expected.begin(), expected.end(),
+                   [sortOrder, attributes](const SortItemPtr& left, const SortItemPtr& right) {
+                     return RowLess(*left, *right, sortOrder == SortOrderDescending,
+                                    !(attributes & SortAttributeIgnoreFolders));
+                   });
+
+  ASSERT_EQ(items.size(), expected.size());
+  for (size_t i = 0; i < items.size(); i++)
+    ASSERT_EQ(items[i], expected[i]) << "sort by " << sortBy << ", position " << i;
+}
+} // namespace
+
 TEST(TestSortUtils, Sort_SortBy)
 {
   SortItems items;
@@ -121,3 +204,19 @@ TEST(TestSortUtils, GetFieldsForSorting)
   EXPECT_EQ(FieldTrackNumber, *it);
   EXPECT_EQ((unsigned int)5, fields.size());
 }
+
+TEST(TestSortUtils, Sort_OrderParity)
+{
+  // small lists are sorted on the calling thread, large ones in chunks on several threads
+  for (size_t count : {1u, 2u, 500u, 40000u})
+  {
+    CheckRowOrder(SortByLabel, SortOrderAscending, SortAttributeNone, count);
+    CheckRowOrder(SortByArtist, SortOrderAscending, SortAttributeIgnoreArticle, count);
+    CheckRowOrder(SortByAlbum, SortOrderDescending, SortAttributeNone, count);
+    CheckRowOrder(SortByYear, SortOrderDescending, SortAttributeIgnoreFolders, count);
+  }
+
+  SortItems items = GetSongs(100);
+  SortUtils::Sort(SortByArtist, SortOrderAscending, SortAttributeNone, items, 30, 10);
+  EXPECT_EQ(items.size(), 20u);
+}
@@ -356,6 +356,27 @@ TEST(TestStringUtils, AlphaNumericCompare)
   EXPECT_LT(var, ref);
 }
 
+TEST(TestStringUtils, AlphaNumericCompareKeys)
+{
+  const std::vector<std::wstring> strings = {
+      L"123abc", L"abc123", L"abc", L"ABC", L"abc12", L"abc2", L"abc002", L"(abc)", L"Abc!",
+      L"\u00e9t\u00e9", L"ete", L"\u00c9T\u00c9", L"", L"a 10 b", L"a 9 b", L"12345678901234567"};
+  for (const auto& left : strings)
+  {
+    std::u32string leftKey;
+    StringUtils::AppendAlphaNumericSortKey(left.c_str(), leftKey);
+    for (const auto& right : strings)
+    {
+      std::u32string rightKey;
+      StringUtils::AppendAlphaNumericSortKey(right.c_str(), rightKey);
+      const int64_t expected = StringUtils::AlphaNumericCompare(left.c_str(), right.c_str());
+      const int64_t result = StringUtils::AlphaNumericCompareKeys(leftKey, rightKey);
+      EXPECT_EQ(expected < 0, result < 0);
+      EXPECT_EQ(expected > 0, result > 0);
+    }
+  }
+}
+
 TEST(TestStringUtils, TimeStringToSeconds)
 {
   EXPECT_EQ(77455, StringUtils::TimeStringToSeconds("21:30:55"));
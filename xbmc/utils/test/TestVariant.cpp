@@ -273,6 +273,62 @@ TEST(TestVariant, iterator_map)
   }
 }
 
+TEST(TestVariant, iterator_map_order)
+{
+  // members are kept sorted by key, whatever the order they were added in
+  const std::string longKey(100, 'k');
+  CVariant a;
+  a["label"] = "label";
+  a["file"] = "file";
+  a[longKey] = "long";
+  a["thumbnail"] = "thumbnail";
+  a["art"]["poster"] = "poster";
+
+  std::vector<std::string> keys;
+  for (auto it = a.begin_map(); it != a.end_map(); ++it)
+    keys.push_back(it->first);
+  EXPECT_EQ(keys, std::vector<std::string>({"art", "file", longKey, "label", "thumbnail"}));
+  EXPECT_STREQ("long", a[longKey].c_str());
+  EXPECT_STREQ("poster", a["art"]["poster"].c_str());
+
+  CVariant::const_iterator_map last = a.end_map();
+  --last;
+  EXPECT_EQ("thumbnail", last->first);
+  EXPECT_EQ("thumbnail", (*last).second.asString());
+
+  // copies are independent of each other, including keys that aren't shared
+  CVariant b = a;
+  a.erase(longKey);
+  a.erase("file");
+  EXPECT_EQ(3u, a.size());
+  EXPECT_FALSE(a.isMember(longKey));
+  EXPECT_EQ(5u, b.size());
+  EXPECT_STREQ("long", b[longKey].c_str());
+  EXPECT_NE(a, b);
+  b.erase(longKey);
+  b.erase("file");
+  EXPECT_EQ(a, b);
+}
+
+TEST(TestVariant, object_null_member)
+{
+  // a const null member keeps its value while other members are moved around
+  CVariant a;
+  a["z"] = CVariant::ConstNullVariant;
+  for (char c = 'y'; c >= 'a'; c--)
+    a[std::string(1, c)] = std::string(1, c);
+
+  EXPECT_EQ(26u, a.size());
+  EXPECT_TRUE(a["z"].isNull());
+  EXPECT_STREQ("a", a["a"].c_str());
+  EXPECT_STREQ("y", a["y"].c_str());
+
+  CVariant b(CVariant::VariantTypeObject);
+  b["a"] = CVariant::ConstNullVariant;
+  b = a;
+  EXPECT_EQ(a, b);
+}
+
 TEST(TestVariant, size)
 {
   std::vector<std::string> strarray;
@@ -642,8 +642,8 @@ int CVideoDatabase::GetPathId(const std::string& strPath)
 
     URIUtils::AddSlashAtEnd(strPath1);
 
-    strSQL=PrepareSQL("select idPath from path where strPath='%s'",strPath1.c_str());
-    m_pDS->query(strSQL);
+    strSQL = "select idPath from path where strPath=?";
+    m_pDS->query(strSQL, {dbiplus::field_value(strPath1)});
     if (!m_pDS->eof())
       idPath = m_pDS->fv("path.idPath").get_asInt();
 
@@ -804,6 +804,54 @@ int CVideoDatabase::RunQuery(const std::string &sql)
   return rows;
 }
 
+bool CVideoDatabase::GetSortKeys(const MediaType& mediaType,
+                                 const SortDescription& sorting,
+                                 std::vector<std::string>& keys) const
+{
+  FieldList fields;
+  SortUtils::GetFieldsForSQLSort(mediaType, sorting.sortBy, fields);
+  // only the id, the sort method isn't supported
+  if (fields.size() < 2)
+    return false;
+
+  // Not prepared, the ignore article list contains ' and % which PrepareSQL would escape again
+  keys.clear();
+  for (const auto& field : fields)
+  {
+    std::string key;
+    if (field == FieldSortTitle) // sort title with fallback to the title
+      key = DatabaseUtils::GetField(FieldTitle, mediaType, DatabaseQueryPartOrderBy);
+    else
+      key = DatabaseUtils::GetField(field, mediaType, DatabaseQueryPartSelect);
+    if (key.empty())
+      return false;
+
+    if (field == FieldTitle || field == FieldSortTitle)
+    {
+      if (sorting.sortAttributes & SortAttributeIgnoreArticle)
+      {
+        const std::string articles = GetIgnoreArticleSQL(key);
+        if (!articles.empty())
+          key = "CASE " + articles + " ELSE " + key + " END";
+      }
+      // natural number, case insensitive order like SortUtils. The collation only exists in
+      // SQLite, PrepareSQL would strip it for MySQL but the keys aren't prepared.
+      key = "COALESCE(" + key + ", '')";
+      if (m_sqlite)
+        key += " COLLATE ALPHANUM";
+    }
+    else if (field == FieldYear)
+      key = "COALESCE(SUBSTR(" + key + ", 1, 4), '')";
+    else if (field == FieldDateAdded || field == FieldLastPlayed)
+      key = "COALESCE(" + key + ", '')";
+    else if (field != FieldId)
+      key = "COALESCE(" + key + ", 0)";
+
+    keys.emplace_back(std::move(key));
+  }
+  return true;
+}
+
 bool CVideoDatabase::GetSubPaths(const std::string &basepath, std::vector<std::pair<int, std::string>>& subpaths)
 {
   std::string sql;
@@ -858,21 +906,15 @@ int CVideoDatabase::AddPath(const std::string& strPath, const std::string &paren
     int idParentPath = GetPathId(parentPath.empty() ? URIUtils::GetParentPath(strPath1) : parentPath);
 
     // add the path
+    dbiplus::field_value dbDateAdded(dateAdded.GetAsDBDateTime());
+    if (!dateAdded.IsValid())
+      dbDateAdded.set_isNull();
+    dbiplus::field_value dbParentPath(idParentPath);
     if (idParentPath < 0)
-    {
-      if (dateAdded.IsValid())
-        strSQL=PrepareSQL("insert into path (idPath, strPath, dateAdded) values (NULL, '%s', '%s')", strPath1.c_str(), dateAdded.GetAsDBDateTime().c_str());
-      else
-        strSQL=PrepareSQL("insert into path (idPath, strPath) values (NULL, '%s')", strPath1.c_str());
-    }
-    else
-    {
-      if (dateAdded.IsValid())
-        strSQL = PrepareSQL("insert into path (idPath, strPath, dateAdded, idParentPath) values (NULL, '%s', '%s', %i)", strPath1.c_str(), dateAdded.GetAsDBDateTime().c_str(), idParentPath);
-      else
-        strSQL=PrepareSQL("insert into path (idPath, strPath, idParentPath) values (NULL, '%s', %i)", strPath1.c_str(), idParentPath);
-    }
-    m_pDS->exec(strSQL);
+      dbParentPath.set_isNull();
+
+    strSQL = "insert into path (idPath, strPath, dateAdded, idParentPath) values (NULL, ?, ?, ?)";
+    m_pDS->exec(strSQL, {dbiplus::field_value(strPath1), dbDateAdded, dbParentPath});
     idPath = (int)m_pDS->lastinsertid();
     return idPath;
   }
@@ -1013,9 +1055,9 @@ int CVideoDatabase::AddFile(const std::string& strFileNameAndPath,
     if (idPath < 0)
       return -1;
 
-    std::string strSQL=PrepareSQL("select idFile from files where strFileName='%s' and idPath=%i", strFileName.c_str(),idPath);
+    strSQL = "select idFile from files where strFileName=? and idPath=?";
 
-    m_pDS->query(strSQL);
+    m_pDS->query(strSQL, {dbiplus::field_value(strFileName), dbiplus::field_value(idPath)});
     if (m_pDS->num_rows() > 0)
     {
       idFile = m_pDS->fv("idFile").get_asInt() ;
@@ -1024,17 +1066,18 @@ int CVideoDatabase::AddFile(const std::string& strFileNameAndPath,
     }
     m_pDS->close();
 
-    std::string strPlaycount = "NULL";
-    if (playcount > 0)
-      strPlaycount = std::to_string(playcount);
-    std::string strLastPlayed = "NULL";
-    if (lastPlayed.IsValid())
-      strLastPlayed = "'" + lastPlayed.GetAsDBDateTime() + "'";
-
-    strSQL = PrepareSQL("INSERT INTO files (idFile, idPath, strFileName, playCount, lastPlayed, dateAdded) "
-                        "VALUES(NULL, %i, '%s', " + strPlaycount + ", " + strLastPlayed + ", '%s')",
-                        idPath, strFileName.c_str(), finalDateAdded.GetAsDBDateTime().c_str());
-    m_pDS->exec(strSQL);
+    dbiplus::field_value dbPlaycount(playcount);
+    if (playcount <= 0)
+      dbPlaycount.set_isNull();
+    dbiplus::field_value dbLastPlayed(lastPlayed.GetAsDBDateTime());
+    if (!lastPlayed.IsValid())
+      dbLastPlayed.set_isNull();
+
+    strSQL = "INSERT INTO files (idFile, idPath, strFileName, playCount, lastPlayed, dateAdded) "
+             "VALUES(NULL, ?, ?, ?, ?, ?)";
+    m_pDS->exec(strSQL, {dbiplus::field_value(idPath), dbiplus::field_value(strFileName),
+                         dbPlaycount, dbLastPlayed,
+                         dbiplus::field_value(finalDateAdded.GetAsDBDateTime())});
     idFile = (int)m_pDS->lastinsertid();
     return idFile;
   }
@@ -1215,9 +1258,8 @@ int CVideoDatabase::GetFileId(const std::string& strFilenameAndPath)
     int idPath = GetPathId(strPath);
     if (idPath >= 0)
     {
-      std::string strSQL;
-      strSQL=PrepareSQL("select idFile from files where strFileName='%s' and idPath=%i", strFileName.c_str(),idPath);
-      m_pDS->query(strSQL);
+      m_pDS->query("select idFile from files where strFileName=? and idPath=?",
+                   {dbiplus::field_value(strFileName), dbiplus::field_value(idPath)});
       if (m_pDS->num_rows() > 0)
       {
         int idFile = m_pDS->fv("files.idFile").get_asInt();
@@ -2195,26 +2237,30 @@ bool CVideoDatabase::GetMovieInfo(const std::string& strFilenameAndPath,
       return false;
 
     std::string sql;
+    dbiplus::ParamValues params{dbiplus::field_value(idMovie)};
     if (idVersion >= 0)
     {
       //! @todo get rid of "videos with versions as folder" hack!
       if (idVersion != VIDEO_VERSION_ID_ALL)
-        sql = PrepareSQL("SELECT * FROM movie_view WHERE idMovie = %i AND videoVersionTypeId = %i",
-                         idMovie, idVersion);
+      {
+        sql = "SELECT * FROM movie_view WHERE idMovie = ? AND videoVersionTypeId = ?";
+        params.emplace_back(idVersion);
+      }
     }
     else if (!strFilenameAndPath.empty())
     {
       const int idFile{GetFileId(strFilenameAndPath)};
       if (idFile != -1)
-        sql = PrepareSQL("SELECT * FROM movie_view WHERE idMovie = %i AND videoVersionIdFile = %i",
-                         idMovie, idFile);
+      {
+        sql = "SELECT * FROM movie_view WHERE idMovie = ? AND videoVersionIdFile = ?";
+        params.emplace_back(idFile);
+      }
     }
 
     if (sql.empty())
-      sql = PrepareSQL("SELECT * FROM movie_view WHERE idMovie = %i AND isDefaultVersion = 1",
-                       idMovie);
+      sql = "SELECT * FROM movie_view WHERE idMovie = ? AND isDefaultVersion = 1";
 
-    if (!m_pDS->query(sql))
+    if (!m_pDS->query(sql, params))
       return false;
 
     details = GetDetailsForMovie(m_pDS, getDetails);
@@ -8275,6 +8321,11 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
     if (!CDatabase::BuildSQL(strSQLExtra, extFilter, strSQLExtra))
       return false;
 
+    std::string fields = !extFilter.fields.empty() ? extFilter.fields : "*";
+    std::vector<std::string> sortKeys;
+    std::string sortKeyFields;
+    SortDescription sortResults = sortDescription;
+
     // Apply the limiting directly here if there's no special sorting but limiting
     if (extFilter.limit.empty() && sorting.sortBy == SortByNone &&
         (sorting.limitStart > 0 || sorting.limitEnd > 0 ||
@@ -8283,8 +8334,53 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
       total = (int)strtol(GetSingleValue(PrepareSQL(strSQL, "COUNT(1)") + strSQLExtra, m_pDS).c_str(), NULL, 10);
       strSQLExtra += DatabaseUtils::BuildLimitClause(sorting.limitEnd, sorting.limitStart);
     }
+    // Sort and page in SQL if only a page of a sorted listing is requested, so the rows outside
+    // of it are neither fetched nor sorted. A cursor continues right after the last item of the
+    // previous page (keyset pagination) instead of skipping limitStart rows again.
+    else if (extFilter.limit.empty() && extFilter.order.empty() && fields == "*" &&
+             sorting.limitEnd > 0 && GetSortKeys(MediaTypeMovie, sorting, sortKeys))
+    {
+      total = (int)strtol(GetSingleValue(PrepareSQL(strSQL, "COUNT(1)") + strSQLExtra, m_pDS).c_str(), NULL, 10);
 
-    strSQL = PrepareSQL(strSQL, !extFilter.fields.empty() ? extFilter.fields.c_str() : "*") + strSQLExtra;
+      const bool descending = sorting.sortOrder == SortOrderDescending;
+      int limitStart = sorting.limitStart;
+      if (!sorting.limitCursor.empty())
+      {
+        CVariant cursorValues;
+        ParamValues params;
+        std::string condition;
+        if (DatabaseUtils::DecodeKeysetCursor(sorting, cursorValues))
+          condition =
+              DatabaseUtils::BuildKeysetCondition(sortKeys, descending, cursorValues, params);
+        if (condition.empty())
+        {
+          CLog::Log(LOGERROR, "{} - invalid cursor for the requested sorting", __FUNCTION__);
+          return false;
+        }
+        extFilter.AppendWhere(m_pDB->bind_params(condition, params));
+        limitStart = 0;
+      }
+
+      for (const auto& key : sortKeys)
+        extFilter.AppendOrder(descending ? key + " DESC" : key);
+      const int count =
+          static_cast<int>(DatabaseUtils::GetLimitCount(sorting.limitEnd, sorting.limitStart));
+      extFilter.limit = DatabaseUtils::BuildLimitClauseOnly(limitStart + count, limitStart);
+
+      strSQLExtra.clear();
+      if (!CDatabase::BuildSQL(strSQLExtra, extFilter, strSQLExtra))
+        return false;
+
+      // the sort keys are selected after the movie_view columns to build the next cursor
+      sortKeyFields = ", " + StringUtils::Join(sortKeys, ", ");
+      sortResults.sortBy = SortByNone;
+    }
+
+    // the sort keys are already complete SQL and must not be prepared again
+    strSQL = PrepareSQL(strSQL, fields.c_str());
+    if (!sortKeyFields.empty())
+      strSQL.insert(strSQL.find(" from "), sortKeyFields);
+    strSQL += strSQLExtra;
 
     int iRowsFound = RunQuery(strSQL);
 
@@ -8296,10 +8392,26 @@ bool CVideoDatabase::GetMoviesByWhere(const std::string& strBaseDir, const Filte
     if (iRowsFound <= 0)
       return iRowsFound == 0;
 
+    if (!sortKeys.empty())
+    {
+      const query_data& rows = m_pDS->get_result_set().records;
+      const unsigned int firstKey = rows.num_columns() - static_cast<unsigned int>(sortKeys.size());
+      CVariant cursorValues(CVariant::VariantTypeArray);
+      field_value value;
+      for (unsigned int i = firstKey; i < rows.num_columns(); i++)
+      {
+        CVariant key;
+        rows.get_value(rows.size() - 1, i, value);
+        DatabaseUtils::GetFieldValue(value, key);
+        cursorValues.push_back(key);
+      }
+      items.SetProperty("cursor", DatabaseUtils::EncodeKeysetCursor(sorting, cursorValues));
+    }
+
     DatabaseResults results;
     results.reserve(iRowsFound);
 
-    if (!SortUtils::SortFromDataset(sortDescription, MediaTypeMovie, m_pDS, results))
+    if (!SortUtils::SortFromDataset(sortResults, MediaTypeMovie, m_pDS, results))
       return false;
 
     // get data from returned rows
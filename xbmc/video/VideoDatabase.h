@@ -1251,6 +1251,18 @@ private:
    */
   int RunQuery(const std::string &sql);
 
+  /*! \brief Get the SQL expressions to sort a media type by, matching the order of SortUtils
+   The last expression is the item id so the keys can be used for keyset pagination. The keys
+   contain quoted literals and must not be passed through PrepareSQL.
+   \param mediaType the media type of the queried view
+   \param sorting the requested sorting
+   \param keys receives the sort key expressions
+   \return false if the sort method can't be done in SQL
+   */
+  bool GetSortKeys(const MediaType& mediaType,
+                   const SortDescription& sorting,
+                   std::vector<std::string>& keys) const;
+
   void AppendIdLinkFilter(const char* field, const char *table, const MediaType& mediaType, const char *view, const char *viewKey, const CUrlOptions::UrlOptions& options, Filter &filter);
   void AppendLinkFilter(const char* field, const char *table, const MediaType& mediaType, const char *view, const char *viewKey, const CUrlOptions::UrlOptions& options, Filter &filter);
 
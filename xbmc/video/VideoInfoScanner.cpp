@@ -42,12 +42,14 @@
 #include "utils/Digest.h"
 #include "utils/FileExtensionProvider.h"
 #include "utils/RegExp.h"
+#include "utils/RegExpSet.h"
 #include "utils/StringUtils.h"
 #include "utils/URIUtils.h"
 #include "utils/Variant.h"
 #include "utils/log.h"
 #include "video/VideoFileItemClassify.h"
 #include "video/VideoManagerTypes.h"
+#include "video/VideoScanPrefetcher.h"
 #include "video/VideoThumbLoader.h"
 #include "video/VideoUtils.h"
 #include "video/dialogs/GUIDialogVideoManagerExtras.h"
@@ -67,6 +69,8 @@ using KODI::UTILITY::CDigest;
 
 namespace KODI::VIDEO
 {
+  // number of paths fetched ahead of the scan for each allowed connection
+  constexpr unsigned int PREFETCH_PATHS_PER_CONNECTION = 16;
 
   CVideoInfoScanner::CVideoInfoScanner()
   {
@@ -128,9 +132,47 @@ namespace KODI::VIDEO
       // result in unexpected behaviour.
       m_bCanInterrupt = false;
 
+      // fetch the directories ahead of the scan, the network round trips are what takes the
+      // time if nothing changed
+      const auto advancedSettings = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings();
+      if (advancedSettings->m_iVideoScannerPrefetchConnections > 0)
+      {
+        const bool useFastHash = advancedSettings->m_bVideoLibraryUseFastHash;
+        const unsigned int connections = advancedSettings->m_iVideoScannerPrefetchConnections;
+        m_prefetcher = std::make_unique<CVideoScanPrefetcher>(
+            [this, useFastHash](const std::string& path,
+                                CVideoScanPrefetcher::CDirectoryInfo& info) {
+              info.exists = CDirectory::Exists(path);
+              if (!info.exists)
+                return;
+              info.noMedia = HasNoMedia(path);
+              if (info.noMedia || URIUtils::IsPlugin(path))
+                return;
+
+              if (useFastHash)
+              {
+                struct __stat64 buffer;
+                if (XFILE::CFile::Stat(path, &buffer) == 0)
+                  info.mtime = buffer.st_mtime ? buffer.st_mtime : buffer.st_ctime;
+              }
+              else
+              {
+                // without fast hashes every folder has to be listed to check for changes
+                info.items = std::make_unique<CFileItemList>();
+                CDirectory::GetDirectory(
+                    path, *info.items,
+                    CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
+                    DIR_FLAG_DEFAULTS);
+              }
+            },
+            connections, PREFETCH_PATHS_PER_CONNECTION * connections);
+      }
+
       bool bCancelled = false;
       while (!bCancelled && !m_pathsToScan.empty())
       {
+        PrefetchPaths();
+
         /*
          * A copy of the directory path is used because the path supplied is
          * immediately removed from the m_pathsToScan set in DoScan(). If the
@@ -138,11 +180,14 @@ namespace KODI::VIDEO
          * occurs.
          */
         std::string directory = *m_pathsToScan.begin();
+        std::shared_ptr<CVideoScanPrefetcher::CDirectoryInfo> prefetched;
+        if (m_prefetcher && !m_bStop)
+          prefetched = m_prefetcher->Get(directory, [this]() { return m_bStop; });
         if (m_bStop)
         {
           bCancelled = true;
         }
-        else if (!CDirectory::Exists(directory))
+        else if (prefetched ? !prefetched->exists : !CDirectory::Exists(directory))
         {
           /*
            * Note that this will skip clean (if m_bClean is enabled) if the directory really
@@ -152,10 +197,13 @@ namespace KODI::VIDEO
           CLog::Log(LOGWARNING, "{} directory '{}' does not exist - skipping scan{}.", __FUNCTION__,
                     CURL::GetRedacted(directory), m_bClean ? " and clean" : "");
           m_pathsToScan.erase(m_pathsToScan.begin());
+          if (m_prefetcher)
+            m_prefetcher->Take(directory);
         }
         else if (!DoScan(directory))
           bCancelled = true;
       }
+      m_prefetcher.reset();
 
       if (!bCancelled)
       {
@@ -182,6 +230,7 @@ namespace KODI::VIDEO
     {
       CLog::Log(LOGERROR, "VideoInfoScanner: Exception while scanning.");
     }
+    m_prefetcher.reset();
 
     m_bRunning = false;
     CServiceBroker::GetAnnouncementManager()->Announce(ANNOUNCEMENT::VideoLibrary,
@@ -260,6 +309,9 @@ namespace KODI::VIDEO
     if (it != m_pathsToScan.end())
       m_pathsToScan.erase(it);
 
+    const auto prefetched =
+        m_prefetcher ? m_prefetcher->Take(strDirectory, [this]() { return m_bStop; }) : nullptr;
+
     // load subfolder
     CFileItemList items;
     bool foundDirectly = false;
@@ -276,7 +328,7 @@ namespace KODI::VIDEO
     if (CUtil::ExcludeFileOrFolder(strDirectory, regexps))
       return true;
 
-    if (HasNoMedia(strDirectory))
+    if (prefetched ? prefetched->noMedia : HasNoMedia(strDirectory))
       return true;
 
     bool ignoreFolder = !m_scanAll && settings.noupdate;
@@ -303,7 +355,8 @@ namespace KODI::VIDEO
 
       std::string fastHash;
       if (CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_bVideoLibraryUseFastHash && !URIUtils::IsPlugin(strDirectory))
-        fastHash = GetFastHash(strDirectory, regexps);
+        fastHash = prefetched ? GetFastHash(prefetched->mtime, regexps)
+                              : GetFastHash(strDirectory, regexps);
 
       if (m_database.GetPathHash(strDirectory, dbHash) && !fastHash.empty() && StringUtils::EqualsNoCase(fastHash, dbHash))
       { // fast hashes match - no need to process anything
@@ -311,8 +364,11 @@ namespace KODI::VIDEO
       }
       else
       { // need to fetch the folder
-        CDirectory::GetDirectory(strDirectory, items, CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
-                                 DIR_FLAG_DEFAULTS);
+        if (prefetched && prefetched->items)
+          items.Assign(*prefetched->items);
+        else
+          CDirectory::GetDirectory(strDirectory, items, CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
+                                   DIR_FLAG_DEFAULTS);
         // do not consider inner folders with .nomedia
         items.erase(std::remove_if(items.begin(), items.end(),
                                    [this](const CFileItemPtr& item) {
@@ -362,8 +418,11 @@ namespace KODI::VIDEO
 
       if (foundDirectly && !settings.parent_name_root)
       {
-        CDirectory::GetDirectory(strDirectory, items, CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
-                                 DIR_FLAG_DEFAULTS);
+        if (prefetched && prefetched->items)
+          items.Assign(*prefetched->items);
+        else
+          CDirectory::GetDirectory(strDirectory, items, CServiceBroker::GetFileExtensionProvider().GetVideoExtensions(),
+                                   DIR_FLAG_DEFAULTS);
         items.SetPath(strDirectory);
         GetPathHash(items, hash);
         bSkip = true;
@@ -1253,7 +1312,8 @@ namespace KODI::VIDEO
 
   bool CVideoInfoScanner::EnumerateEpisodeItem(const CFileItem *item, EPISODELIST& episodeList)
   {
-    SETTINGS_TVSHOWLIST expression = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_tvshowEnumRegExps;
+    const SETTINGS_TVSHOWLIST& expression =
+        CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_tvshowEnumRegExps;
 
     std::string strLabel;
 
@@ -1269,16 +1329,18 @@ namespace KODI::VIDEO
     // URLDecode in case an episode is on a http/https/dav/davs:// source and URL-encoded like foo%201x01%20bar.avi
     strLabel = CURL::Decode(CURL::GetRedacted(strLabel));
 
-    for (unsigned int i=0;i<expression.size();++i)
-    {
-      CRegExp reg(true, CRegExp::autoUtf8);
-      if (!reg.RegComp(expression[i].regexp))
-        continue;
+    // the expressions are compiled once, only the matching ones are copied with their captures
+    std::vector<std::string> regexps;
+    regexps.reserve(expression.size());
+    for (const auto& tvshowRegexp : expression)
+      regexps.push_back(tvshowRegexp.regexp);
+    const auto regexpSet = CRegExpSet::Get(regexps, true, CRegExp::autoUtf8);
 
+    CRegExp reg(true, CRegExp::autoUtf8);
+    for (int i = regexpSet->Find(strLabel, &reg); i > -1;
+         i = regexpSet->Find(strLabel, &reg, i + 1))
+    {
       int regexppos, regexp2pos;
-      //CLog::Log(LOGDEBUG,"running expression {} on {}",expression[i].regexp,strLabel);
-      if ((regexppos = reg.RegFind(strLabel.c_str())) < 0)
-        continue;
 
       EPISODE episode;
       episode.strPath = item->GetPath();
@@ -2241,26 +2303,46 @@ namespace KODI::VIDEO
   std::string CVideoInfoScanner::GetFastHash(const std::string &directory,
       const std::vector<std::string> &excludes) const
   {
-    CDigest digest{CDigest::Type::MD5};
-
-    if (excludes.size())
-      digest.Update(StringUtils::Join(excludes, "|"));
-
     struct __stat64 buffer;
     if (XFILE::CFile::Stat(directory, &buffer) == 0)
     {
       int64_t time = buffer.st_mtime;
       if (!time)
         time = buffer.st_ctime;
-      if (time)
-      {
-        digest.Update((unsigned char *)&time, sizeof(time));
-        return digest.Finalize();
-      }
+      return GetFastHash(time, excludes);
     }
     return "";
   }
 
+  std::string CVideoInfoScanner::GetFastHash(int64_t time,
+                                             const std::vector<std::string>& excludes) const
+  {
+    if (!time)
+      return "";
+
+    CDigest digest{CDigest::Type::MD5};
+
+    if (excludes.size())
+      digest.Update(StringUtils::Join(excludes, "|"));
+
+    digest.Update((unsigned char *)&time, sizeof(time));
+    return digest.Finalize();
+  }
+
+  void CVideoInfoScanner::PrefetchPaths()
+  {
+    if (!m_prefetcher)
+      return;
+
+    // paths that are already queued count against the limit as well, so this stops after at
+    // most a window of paths
+    for (const std::string& path : m_pathsToScan)
+    {
+      if (!m_prefetcher->Prefetch(path))
+        break;
+    }
+  }
+
   std::string CVideoInfoScanner::GetRecursiveFastHash(const std::string &directory,
       const std::vector<std::string> &excludes) const
   {
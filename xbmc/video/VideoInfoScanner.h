@@ -13,6 +13,7 @@
 #include "addons/Scraper.h"
 #include "guilib/GUIListItem.h"
 
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -24,6 +25,7 @@ class CFileItemList;
 namespace KODI::VIDEO
 {
   class IVideoInfoTagLoader;
+  class CVideoScanPrefetcher;
 
   typedef struct SScanSettings
   {
@@ -201,6 +203,13 @@ namespace KODI::VIDEO
      */
     std::string GetFastHash(const std::string &directory, const std::vector<std::string> &excludes) const;
 
+    /*! \brief Create a "fast" hash from the modified time of a directory
+     \param time modified or create time of the directory, 0 if neither is available
+     \param excludes string array of exclude expressions
+     \return the md5 hash of the folder, empty if time is 0
+     */
+    std::string GetFastHash(int64_t time, const std::vector<std::string>& excludes) const;
+
     /*! \brief Retrieve a "fast" hash of the given directory recursively (if available)
      Performs a stat() on the directory, and uses modified time to create a "fast"
      hash of each folder. If no modified time is available, the create time is used,
@@ -242,6 +251,9 @@ namespace KODI::VIDEO
     bool AddVideoExtras(CFileItemList& items, const CONTENT_TYPE& content, const std::string& path);
     bool ProcessVideoVersion(VideoDbContentType itemType, int dbId);
 
+    /*! \brief Queue the next paths to scan for fetching by the prefetcher, if enabled */
+    void PrefetchPaths();
+
     bool m_bStop;
     bool m_scanAll;
     bool m_ignoreVideoVersions{false};
@@ -250,6 +262,7 @@ namespace KODI::VIDEO
     CVideoDatabase m_database;
     std::set<std::string> m_pathsToCount;
     std::set<int> m_pathsToClean;
+    std::unique_ptr<CVideoScanPrefetcher> m_prefetcher;
 
   private:
     static void AddLocalItemArtwork(CGUIListItem::ArtMap& itemArt,
@@ -0,0 +1,128 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "VideoScanPrefetcher.h"
+
+#include "FileItemList.h"
+#include "URL.h"
+#include "utils/JobManager.h"
+
+#include <chrono>
+#include <mutex>
+
+using namespace KODI::VIDEO;
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr auto ABORT_POLL_INTERVAL = 100ms;
+} // unnamed namespace
+
+CVideoScanPrefetcher::CDirectoryInfo::CDirectoryInfo() = default;
+
+CVideoScanPrefetcher::CDirectoryInfo::~CDirectoryInfo() = default;
+
+CVideoScanPrefetcher::CVideoScanPrefetcher(FetchFunction fetch,
+                                           unsigned int connectionsPerHost,
+                                           size_t maxPending)
+  : m_state(std::make_shared<CState>()),
+    m_connectionsPerHost(connectionsPerHost),
+    m_maxPending(maxPending)
+{
+  m_state->fetch = std::move(fetch);
+}
+
+CVideoScanPrefetcher::~CVideoScanPrefetcher()
+{
+  {
+    std::unique_lock<CCriticalSection> lock(m_state->critical);
+    m_state->cancelled = true;
+  }
+  for (auto& queue : m_queues)
+    queue.second->CancelJobs();
+
+  // the fetch function may refer to the owner, so it must not run after we're gone
+  std::unique_lock<CCriticalSection> lock(m_state->critical);
+  m_state->changed.wait(lock, [this]() { return m_state->running == 0; });
+}
+
+bool CVideoScanPrefetcher::Prefetch(const std::string& path)
+{
+  if (m_entries.find(path) != m_entries.end())
+    return true;
+  if (m_entries.size() >= m_maxPending)
+    return false;
+
+  auto entry = std::make_shared<CEntry>();
+  m_entries.emplace(path, entry);
+
+  const CURL url(path);
+  std::unique_ptr<CJobQueue>& queue = m_queues[url.GetProtocol() + "://" + url.GetHostName()];
+  if (!queue)
+    queue = std::make_unique<CJobQueue>(false, m_connectionsPerHost, CJob::PRIORITY_DEDICATED);
+
+  queue->Submit([state = m_state, entry, path]() {
+    {
+      std::unique_lock<CCriticalSection> lock(state->critical);
+      if (state->cancelled)
+        return;
+      state->running++;
+    }
+
+    auto info = std::make_shared<CDirectoryInfo>();
+    state->fetch(path, *info);
+
+    std::unique_lock<CCriticalSection> lock(state->critical);
+    entry->info = std::move(info);
+    entry->done = true;
+    state->running--;
+    state->changed.notifyAll();
+  });
+  return true;
+}
+
+std::shared_ptr<CVideoScanPrefetcher::CDirectoryInfo> CVideoScanPrefetcher::Get(
+    const std::string& path, const AbortFunction& abort)
+{
+  const std::shared_ptr<CEntry> entry = Wait(path, false, abort);
+  return entry ? entry->info : nullptr;
+}
+
+std::shared_ptr<CVideoScanPrefetcher::CDirectoryInfo> CVideoScanPrefetcher::Take(
+    const std::string& path, const AbortFunction& abort)
+{
+  const std::shared_ptr<CEntry> entry = Wait(path, true, abort);
+  return entry ? entry->info : nullptr;
+}
+
+std::shared_ptr<CVideoScanPrefetcher::CEntry> CVideoScanPrefetcher::Wait(
+    const std::string& path, bool remove, const AbortFunction& abort)
+{
+  auto it = m_entries.find(path);
+  if (it == m_entries.end())
+    return nullptr;
+
+  std::shared_ptr<CEntry> entry = it->second;
+  if (remove)
+    m_entries.erase(it);
+
+  std::unique_lock<CCriticalSection> lock(m_state->critical);
+  if (!abort)
+  {
+    m_state->changed.wait(lock, [&entry]() { return entry->done; });
+    return entry;
+  }
+
+  // a fetch from a server which went away can take long, check the abort condition meanwhile
+  while (!m_state->changed.wait(lock, ABORT_POLL_INTERVAL, [&entry]() { return entry->done; }))
+  {
+    if (abort())
+      return nullptr;
+  }
+  return entry;
+}
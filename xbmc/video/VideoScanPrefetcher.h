@@ -0,0 +1,106 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#pragma once
+
+#include "threads/Condition.h"
+#include "threads/CriticalSection.h"
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <stdint.h>
+#include <string>
+
+class CFileItemList;
+class CJobQueue;
+
+namespace KODI::VIDEO
+{
+/*!
+ \brief Fetches information about directories ahead of the video scanner
+
+ A rescan of a network source spends most of its time waiting for round trips to the server,
+ one directory after the other. Paths the scanner is going to visit are handed to Prefetch()
+ in scan order and fetched by background jobs, limited to a number of concurrent connections
+ per host. The scanner still processes the paths one by one in its own order and only picks up
+ the results, so the database sees the same sequence of changes as without prefetching.
+ */
+class CVideoScanPrefetcher
+{
+public:
+  struct CDirectoryInfo
+  {
+    CDirectoryInfo();
+    ~CDirectoryInfo();
+
+    bool exists{false};
+    bool noMedia{false};
+    int64_t mtime{0}; //!< modification time of the directory, 0 if unknown
+    std::unique_ptr<CFileItemList> items; //!< listing of the directory if it was fetched
+  };
+
+  using FetchFunction = std::function<void(const std::string& path, CDirectoryInfo& info)>;
+  //! polled while waiting for a path, returns true to stop waiting
+  using AbortFunction = std::function<bool()>;
+
+  /*!
+   \param fetch called from the background jobs to fill in the information about a path
+   \param connectionsPerHost maximum number of paths of the same host fetched at once
+   \param maxPending maximum number of paths fetched ahead of the scanner
+   */
+  CVideoScanPrefetcher(FetchFunction fetch, unsigned int connectionsPerHost, size_t maxPending);
+
+  /*! \brief Cancels the queued paths and waits for the running fetches */
+  ~CVideoScanPrefetcher();
+
+  /*!
+   \brief Queue a path the scanner is going to visit
+   \return false if there are already maxPending paths queued or fetched, true otherwise
+   */
+  bool Prefetch(const std::string& path);
+
+  /*!
+   \brief Get the information about a queued path, waits until it has been fetched
+   \param abort checked regularly while waiting, e.g. for the scanner being stopped
+   \return the information or nullptr if the path wasn't queued or the wait was aborted
+   */
+  std::shared_ptr<CDirectoryInfo> Get(const std::string& path, const AbortFunction& abort = {});
+
+  /*! \brief Like Get(), but the path is removed from the prefetcher to make room for others */
+  std::shared_ptr<CDirectoryInfo> Take(const std::string& path, const AbortFunction& abort = {});
+
+private:
+  CVideoScanPrefetcher(const CVideoScanPrefetcher&) = delete;
+  CVideoScanPrefetcher& operator=(const CVideoScanPrefetcher&) = delete;
+
+  struct CEntry
+  {
+    bool done{false};
+    std::shared_ptr<CDirectoryInfo> info;
+  };
+
+  //! state shared with the jobs, which may still be queued when the prefetcher is gone
+  struct CState
+  {
+    CCriticalSection critical;
+    XbmcThreads::ConditionVariable changed;
+    FetchFunction fetch;
+    bool cancelled{false};
+    unsigned int running{0};
+  };
+
+  std::shared_ptr<CEntry> Wait(const std::string& path, bool remove, const AbortFunction& abort);
+
+  std::shared_ptr<CState> m_state;
+  const unsigned int m_connectionsPerHost;
+  const size_t m_maxPending;
+  std::map<std::string, std::shared_ptr<CEntry>> m_entries;
+  std::map<std::string, std::unique_ptr<CJobQueue>> m_queues;
+};
+} // namespace KODI::VIDEO
@@ -11,7 +11,7 @@
 #include "FileItem.h"
 #include "FileItemList.h"
 #include "ServiceBroker.h"
-#include "TextureDatabase.h"
+#include "TextureCache.h"
 #include "URL.h"
 #include "Util.h"
 #include "addons/Scraper.h"
@@ -270,14 +270,9 @@ bool CVideoLibraryRefreshingJob::Work(CVideoDatabase &db)
     }
 
     // before we start downloading all the necessary information cleanup any existing artwork and hashes
-    CTextureDatabase textureDb;
-    if (textureDb.Open())
-    {
-      for (const auto& artwork : m_item->GetArt())
-        textureDb.InvalidateCachedTexture(artwork.second);
-
-      textureDb.Close();
-    }
+    const std::shared_ptr<CTextureCache> textureCache = CServiceBroker::GetTextureCache();
+    for (const auto& artwork : m_item->GetArt())
+      textureCache->InvalidateCachedTexture(artwork.second);
     m_item->ClearArt();
 
     // put together the list of items to refresh
@@ -0,0 +1,160 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "FileItem.h"
+#include "FileItemList.h"
+#include "ServiceBroker.h"
+#include "XBDateTime.h"
+#include "dbwrappers/dataset.h"
+#include "filesystem/SpecialProtocol.h"
+#include "settings/AdvancedSettings.h"
+#include "settings/SettingsComponent.h"
+#include "utils/SortUtils.h"
+#include "video/VideoDatabase.h"
+#include "video/VideoInfoTag.h"
+
+#include <cstdio>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+class CTestVideoDatabase : public CVideoDatabase
+{
+public:
+  bool Create()
+  {
+    DatabaseSettings settings;
+    settings.type = "sqlite3";
+    settings.host = CSpecialProtocol::TranslatePath("special://temp/");
+    settings.name = "TestVideoDatabase.db";
+    return Connect(settings.name, settings, true);
+  }
+
+  int AddMovie(const std::string& path, const char* title, const char* premiered)
+  {
+    CVideoInfoTag details;
+    details.SetPath(path);
+    details.m_dateAdded = CDateTime(2026, 1, 1, 0, 0, 0);
+
+    BeginTransaction();
+    const int idMovie = AddNewMovie(details);
+    CommitTransaction();
+    if (idMovie < 0)
+      return idMovie;
+
+    dbiplus::field_value titleValue(title ? title : "");
+    if (!title)
+      titleValue.set_isNull();
+    dbiplus::field_value premieredValue(premiered ? premiered : "");
+    if (!premiered)
+      premieredValue.set_isNull();
+    m_pDS->exec("UPDATE movie SET c00 = ?, premiered = ? WHERE idMovie = ?",
+                {titleValue, premieredValue, dbiplus::field_value(idMovie)});
+    return idMovie;
+  }
+};
+
+class TestVideoDatabase : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    ASSERT_TRUE(m_db.Create());
+    m_tokens = CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_vecTokens;
+    CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_vecTokens = {"the "};
+  }
+
+  void TearDown() override
+  {
+    CServiceBroker::GetSettingsComponent()->GetAdvancedSettings()->m_vecTokens = m_tokens;
+    m_db.Close();
+    std::remove(CSpecialProtocol::TranslatePath("special://temp/TestVideoDatabase.db").c_str());
+  }
+
+  int AddMovie(const char* title, const char* premiered = nullptr)
+  {
+    const int idMovie = m_db.AddMovie(
+        "/movies/" + std::to_string(m_movies++) + ".mkv", title, premiered);
+    EXPECT_GT(idMovie, 0);
+    return idMovie;
+  }
+
+  // fetches every page of the listing, each page continues at the cursor of the previous one
+  std::vector<int> GetPages(SortDescription sorting, int pageSize)
+  {
+    std::vector<int> ids;
+    sorting.limitEnd = pageSize;
+    for (int page = 0; page <= m_movies; ++page)
+    {
+      CFileItemList items;
+      EXPECT_TRUE(m_db.GetMoviesByWhere("videodb://movies/titles/", CDatabase::Filter(), items,
+                                        sorting));
+      for (const auto& item : items)
+        ids.push_back(item->GetVideoInfoTag()->m_iDbId);
+      if (items.Size() < pageSize)
+        break;
+      sorting.limitCursor = items.GetProperty("cursor").asString();
+      EXPECT_FALSE(sorting.limitCursor.empty());
+    }
+    return ids;
+  }
+
+  CTestVideoDatabase m_db;
+  std::set<std::string> m_tokens;
+  int m_movies = 0;
+};
+} // namespace
+
+TEST_F(TestVideoDatabase, PageIgnoreArticle)
+{
+  const int gamma = AddMovie("Gamma");
+  const int theBeta = AddMovie("The Beta");
+  const int alpha = AddMovie("Alpha");
+  const int theAlpha = AddMovie("The Alpha");
+  const int delta = AddMovie("Delta");
+
+  SortDescription sorting;
+  sorting.sortBy = SortByTitle;
+  sorting.sortAttributes = SortAttributeIgnoreArticle;
+  EXPECT_EQ(GetPages(sorting, 2), std::vector<int>({alpha, theAlpha, theBeta, delta, gamma}));
+
+  sorting.sortOrder = SortOrderDescending;
+  EXPECT_EQ(GetPages(sorting, 2), std::vector<int>({gamma, delta, theBeta, theAlpha, alpha}));
+
+  sorting.sortAttributes = SortAttributeNone;
+  sorting.sortOrder = SortOrderAscending;
+  EXPECT_EQ(GetPages(sorting, 3), std::vector<int>({alpha, delta, gamma, theAlpha, theBeta}));
+}
+
+TEST_F(TestVideoDatabase, PageEmptySortKeys)
+{
+  const int empty = AddMovie("");
+  const int beta = AddMovie("Beta", "2001-05-01");
+  const int null = AddMovie(nullptr);
+  const int alpha = AddMovie("Alpha");
+  const int empty2 = AddMovie("", "2001-01-01");
+  const int null2 = AddMovie(nullptr, "1999-01-01");
+
+  // empty and missing keys sort first and are ordered by id, pages end within them
+  SortDescription sorting;
+  sorting.sortBy = SortByTitle;
+  sorting.sortAttributes = SortAttributeIgnoreArticle;
+  EXPECT_EQ(GetPages(sorting, 2), std::vector<int>({empty, null, empty2, null2, alpha, beta}));
+  EXPECT_EQ(GetPages(sorting, 1), std::vector<int>({empty, null, empty2, null2, alpha, beta}));
+
+  sorting.sortBy = SortByYear;
+  sorting.sortAttributes = SortAttributeNone;
+  EXPECT_EQ(GetPages(sorting, 2), std::vector<int>({empty, null, alpha, null2, empty2, beta}));
+
+  sorting.sortOrder = SortOrderDescending;
+  EXPECT_EQ(GetPages(sorting, 4), std::vector<int>({beta, empty2, null2, alpha, null, empty}));
+}
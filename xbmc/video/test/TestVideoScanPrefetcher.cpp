@@ -0,0 +1,285 @@
+/*
+ *  Copyright (C) 2026 Team Kodi
+ *  This file is part of Kodi - https://kodi.tv
+ *
+ *  SPDX-License-Identifier: GPL-2.0-or-later
+ *  See LICENSES/README.md for more information.
+ */
+
+#include "ServiceBroker.h"
+#include "utils/JobManager.h"
+#include "video/VideoScanPrefetcher.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using namespace KODI::VIDEO;
+
+namespace
+{
+// simulates the round trip to a file server
+constexpr auto ROUND_TRIP = std::chrono::milliseconds(2);
+
+class CFakeServers
+{
+public:
+  void Fetch(const std::string& path, CVideoScanPrefetcher::CDirectoryInfo& info)
+  {
+    const std::string host = GetHost(path);
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      const int running = ++m_running[host];
+      m_maxRunning[host] = std::max(m_maxRunning[host], running);
+      m_order[host].push_back(path);
+      m_changed.notify_all();
+
+      // held fetches wait for Release()
+      m_changed.wait(lock, [this]() { return !m_hold; });
+    }
+
+    std::this_thread::sleep_for(ROUND_TRIP);
+    info.exists = path.find("missing") == std::string::npos;
+    info.mtime = static_cast<int64_t>(path.size());
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_running[host]--;
+    m_fetched++;
+  }
+
+  void Hold()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_hold = true;
+  }
+
+  void Release()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_hold = false;
+    m_changed.notify_all();
+  }
+
+  bool WaitForRunning(const std::string& host, int count)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_changed.wait_for(lock, std::chrono::seconds(10),
+                              [this, &host, count]() { return m_running[host] >= count; });
+  }
+
+  int Running(const std::string& host)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_running[host];
+  }
+
+  int MaxRunning(const std::string& host)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_maxRunning[host];
+  }
+
+  int Fetched()
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_fetched;
+  }
+
+  //! paths of a host in the order their fetch started
+  std::vector<std::string> Order(const std::string& host)
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    return m_order[host];
+  }
+
+  static std::string GetHost(const std::string& path) { return path.substr(0, path.find('/', 6)); }
+
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_changed;
+  bool m_hold = false;
+  std::map<std::string, int> m_running;
+  std::map<std::string, int> m_maxRunning;
+  std::map<std::string, std::vector<std::string>> m_order;
+  int m_fetched = 0;
+};
+
+std::vector<std::string> GetPaths(int count)
+{
+  std::vector<std::string> paths;
+  for (int i = 0; i < count; ++i)
+    paths.emplace_back((i % 2 ? "smb://nas1/movies/" : "nfs://nas2/movies/") +
+                       std::to_string(i) + "/");
+  return paths;
+}
+} // namespace
+
+class TestVideoScanPrefetcher : public testing::Test
+{
+protected:
+  void SetUp() override { CServiceBroker::RegisterJobManager(std::make_shared<CJobManager>()); }
+
+  void TearDown() override
+  {
+    CServiceBroker::GetJobManager()->CancelJobs();
+    CServiceBroker::UnregisterJobManager();
+  }
+};
+
+TEST_F(TestVideoScanPrefetcher, FetchAhead)
+{
+  CFakeServers servers;
+  CVideoScanPrefetcher prefetcher(
+      [&servers](const std::string& path, CVideoScanPrefetcher::CDirectoryInfo& info) {
+        servers.Fetch(path, info);
+      },
+      2, 8);
+
+  const std::vector<std::string> paths = GetPaths(20);
+  EXPECT_EQ(prefetcher.Get(paths[0]), nullptr);
+
+  // the window is limited to 8 paths
+  size_t queued = 0;
+  while (queued < paths.size() && prefetcher.Prefetch(paths[queued]))
+    queued++;
+  EXPECT_EQ(queued, 8u);
+  EXPECT_TRUE(prefetcher.Prefetch(paths[0]));
+
+  // results are handed out in the order the scanner asks for them
+  for (size_t i = 0; i < paths.size(); ++i)
+  {
+    while (queued < paths.size() && prefetcher.Prefetch(paths[queued]))
+      queued++;
+
+    ASSERT_NE(prefetcher.Get(paths[i]), nullptr);
+    const auto info = prefetcher.Take(paths[i]);
+    ASSERT_NE(info, nullptr);
+    EXPECT_TRUE(info->exists);
+    EXPECT_EQ(info->mtime, static_cast<int64_t>(paths[i].size()));
+    EXPECT_EQ(prefetcher.Take(paths[i]), nullptr);
+  }
+  EXPECT_EQ(servers.Fetched(), 20);
+  EXPECT_LE(servers.MaxRunning("smb://nas1"), 2);
+  EXPECT_LE(servers.MaxRunning("nfs://nas2"), 2);
+}
+
+TEST_F(TestVideoScanPrefetcher, FetchOrder)
+{
+  CFakeServers servers;
+  const std::vector<std::string> paths = GetPaths(40);
+  {
+    CVideoScanPrefetcher prefetcher(
+        [&servers](const std::string& path, CVideoScanPrefetcher::CDirectoryInfo& info) {
+          servers.Fetch(path, info);
+        },
+        1, 16);
+    size_t queued = 0;
+    for (const auto& path : paths)
+    {
+      while (queued < paths.size() && prefetcher.Prefetch(paths[queued]))
+        queued++;
+      ASSERT_NE(prefetcher.Take(path), nullptr);
+    }
+  }
+
+  // every path is fetched once, the paths of a host in the order they were queued
+  std::map<std::string, std::vector<std::string>> expected;
+  for (const auto& path : paths)
+    expected[CFakeServers::GetHost(path)].push_back(path);
+  EXPECT_EQ(servers.Fetched(), 40);
+  EXPECT_EQ(servers.Order("smb://nas1"), expected["smb://nas1"]);
+  EXPECT_EQ(servers.Order("nfs://nas2"), expected["nfs://nas2"]);
+}
+
+TEST_F(TestVideoScanPrefetcher, ConnectionsPerHost)
+{
+  CFakeServers servers;
+  servers.Hold();
+  const std::vector<std::string> paths = GetPaths(20);
+  {
+    CVideoScanPrefetcher prefetcher(
+        [&servers](const std::string& path, CVideoScanPrefetcher::CDirectoryInfo& info) {
+          servers.Fetch(path, info);
+        },
+        3, 64);
+    // the job manager only adds a worker when all of them are busy, so every fetch has to be
+    // running before the next one is queued
+    std::map<std::string, int> queued;
+    for (const auto& path : paths)
+    {
+      EXPECT_TRUE(prefetcher.Prefetch(path));
+      const std::string host = CFakeServers::GetHost(path);
+      EXPECT_TRUE(servers.WaitForRunning(host, std::min(++queued[host], 3)));
+    }
+
+    // both hosts are fetched from at once, each with the maximum number of connections
+    EXPECT_EQ(servers.Running("smb://nas1"), 3);
+    EXPECT_EQ(servers.Running("nfs://nas2"), 3);
+    servers.Release();
+
+    for (const auto& path : paths)
+      ASSERT_NE(prefetcher.Take(path), nullptr);
+  }
+  EXPECT_EQ(servers.Fetched(), 20);
+  EXPECT_EQ(servers.MaxRunning("smb://nas1"), 3);
+  EXPECT_EQ(servers.MaxRunning("nfs://nas2"), 3);
+}
+
+TEST_F(TestVideoScanPrefetcher, AbortWait)
+{
+  CFakeServers servers;
+  servers.Hold();
+  CVideoScanPrefetcher prefetcher(
+      [&servers](const std::string& path, CVideoScanPrefetcher::CDirectoryInfo& info) {
+        servers.Fetch(path, info);
+      },
+      1, 8);
+
+  const std::string path = GetPaths(1)[0];
+  ASSERT_TRUE(prefetcher.Prefetch(path));
+  ASSERT_TRUE(servers.WaitForRunning(CFakeServers::GetHost(path), 1));
+
+  // the fetch doesn't return, the scanner is stopped meanwhile
+  int polled = 0;
+  EXPECT_EQ(prefetcher.Get(path, [&polled]() { return ++polled == 2; }), nullptr);
+  EXPECT_EQ(polled, 2);
+
+  // the path is still queued
+  servers.Release();
+  const auto info = prefetcher.Get(path, []() { return false; });
+  ASSERT_NE(info, nullptr);
+  EXPECT_TRUE(info->exists);
+}
+
+TEST_F(TestVideoScanPrefetcher, CancelOnDestruction)
+{
+  CFakeServers servers;
+  std::atomic<bool> destroyed{false};
+  {
+    CVideoScanPrefetcher prefetcher(
+        [&servers, &destroyed](const std::string& path,
+                               CVideoScanPrefetcher::CDirectoryInfo& info) {
+          EXPECT_FALSE(destroyed);
+          servers.Fetch(path, info);
+        },
+        1, 100);
+    for (const auto& path : GetPaths(100))
+      prefetcher.Prefetch(path);
+  }
+  destroyed = true;
+
+  // queued paths are dropped, the running ones have finished
+  const int fetched = servers.Fetched();
+  EXPECT_LT(fetched, 100);
+  std::this_thread::sleep_for(ROUND_TRIP * 5);
+  EXPECT_EQ(servers.Fetched(), fetched);
+}